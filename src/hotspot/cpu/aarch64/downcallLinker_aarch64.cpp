@@ -144,7 +144,9 @@ void DowncallLinker::StubGenerator::generate() {
   assert(_abi._shadow_space_bytes == 0, "not expecting shadow space on AArch64");
   allocated_frame_size += ForeignGlobals::compute_out_arg_bytes(_input_registers);
 
-  bool should_save_return_value = !_needs_return_buffer;
+  // when we don't use a return buffer we need to spill the return value around our slow path calls.
+  // A critical call without state capture has no such calls, so no spill area is needed.
+  bool should_save_return_value = !_needs_return_buffer && (_needs_transition || _captured_state_mask != 0);
   RegSpiller out_reg_spiller(_output_registers);
   int spill_offset = -1;
 
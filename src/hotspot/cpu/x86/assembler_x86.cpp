@@ -15391,6 +15391,13 @@ void Assembler::movq(Register dst, int32_t imm32) {
   emit_int32(imm32);
 }
 
+void Assembler::movntiq(Address dst, Register src) {
+  InstructionMark im(this);
+  int prefix = get_prefixq(dst, src, true /* is_map1 */);
+  emit_prefix_and_int8(prefix, (unsigned char)0xC3);
+  emit_operand(src, dst, 0);
+}
+
 void Assembler::movsbq(Register dst, Address src) {
   InstructionMark im(this);
   int prefix = get_prefixq(src, dst, true /* is_map1 */);
@@ -1656,6 +1656,9 @@ class Assembler : public AbstractAssembler  {
   void movq(Address  dst, int32_t imm32);
   void movq(Register  dst, int32_t imm32);
 
+  // Non-temporal store of a quadword
+  void movntiq(Address dst, Register src);
+
   // Move Quadword
   void movq(Address     dst, XMMRegister src);
   void movq(XMMRegister dst, Address src);
@@ -1257,14 +1257,15 @@ void LIR_Assembler::emit_alloc_array(LIR_OpAllocArray* op) {
 
 void LIR_Assembler::type_profile_helper(Register mdo,
                                         ciMethodData *md, ciProfileData *data,
-                                        Register recv, Label* update_done) {
+                                        Register recv, Label* update_done,
+                                        int increment) {
   for (uint i = 0; i < ReceiverTypeData::row_limit(); i++) {
     Label next_test;
     // See if the receiver is receiver[n].
     __ cmpptr(recv, Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_offset(i))));
     __ jccb(Assembler::notEqual, next_test);
     Address data_addr(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i)));
-    __ addptr(data_addr, DataLayout::counter_increment);
+    __ addptr(data_addr, increment);
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -1276,7 +1277,7 @@ void LIR_Assembler::type_profile_helper(Register mdo,
     __ cmpptr(recv_addr, NULL_WORD);
     __ jccb(Assembler::notEqual, next_test);
     __ movptr(recv_addr, recv);
-    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), DataLayout::counter_increment);
+    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), increment);
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -2782,6 +2783,18 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
   assert(data != nullptr && data->is_CounterData(), "need CounterData for calls");
   assert(op->mdo()->is_single_cpu(),  "mdo must be allocated");
   Register mdo  = op->mdo()->as_register();
+
+  // With sampling, on average one in C1ProfileCallSampleRate executions
+  // (counted per thread) updates the profile, and it does so by the sample
+  // rate.
+  Label update_done;
+  int increment = DataLayout::counter_increment;
+  if (C1ProfileCallSampleRate > 1) {
+    Address countdown(r15_thread, JavaThread::profile_sample_countdown_offset());
+    __ profile_sample(countdown, C1ProfileCallSampleRate, rscratch1, update_done);
+    increment *= (int)C1ProfileCallSampleRate;
+  }
+
   __ mov_metadata(mdo, md->constant_encoding());
   Address counter_addr(mdo, md->byte_offset_of_slot(data, CounterData::count_offset()));
   // Perform additional virtual call profiling for invokevirtual and
@@ -2805,7 +2818,8 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
         ciKlass* receiver = vc_data->receiver(i);
         if (known_klass->equals(receiver)) {
           Address data_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_count_offset(i)));
-          __ addptr(data_addr, DataLayout::counter_increment);
+          __ addptr(data_addr, increment);
+          __ bind(update_done);
           return;
         }
       }
@@ -2821,24 +2835,23 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
           Address recv_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_offset(i)));
           __ mov_metadata(recv_addr, known_klass->constant_encoding(), rscratch1);
           Address data_addr(mdo, md->byte_offset_of_slot(data, VirtualCallData::receiver_count_offset(i)));
-          __ addptr(data_addr, DataLayout::counter_increment);
+          __ addptr(data_addr, increment);
+          __ bind(update_done);
           return;
         }
       }
     } else {
       __ load_klass(recv, recv, tmp_load_klass);
-      Label update_done;
-      type_profile_helper(mdo, md, data, recv, &update_done);
+      type_profile_helper(mdo, md, data, recv, &update_done, increment);
       // Receiver did not match any saved receiver and there is no empty row for it.
       // Increment total counter to indicate polymorphic case.
-      __ addptr(counter_addr, DataLayout::counter_increment);
-
-      __ bind(update_done);
+      __ addptr(counter_addr, increment);
     }
   } else {
     // Static call
-    __ addptr(counter_addr, DataLayout::counter_increment);
+    __ addptr(counter_addr, increment);
   }
+  __ bind(update_done);
 }
 
 void LIR_Assembler::emit_profile_type(LIR_OpProfileType* op) {
@@ -3585,21 +3585,22 @@ void C2_MacroAssembler::arrays_hashcode_elload(Register dst, Address src, BasicT
   }
 }
 
-void C2_MacroAssembler::arrays_hashcode_elvload(XMMRegister dst, Address src, BasicType eltype) {
-  load_vector(eltype, dst, src, arrays_hashcode_elsize(eltype) * 8);
+void C2_MacroAssembler::arrays_hashcode_elvload(XMMRegister dst, Address src, BasicType eltype, int vlen_enc) {
+  const int lanes = (vlen_enc == Assembler::AVX_512bit) ? 16 : 8;
+  load_vector(eltype, dst, src, arrays_hashcode_elsize(eltype) * lanes);
 }
 
-void C2_MacroAssembler::arrays_hashcode_elvload(XMMRegister dst, AddressLiteral src, BasicType eltype) {
-  load_vector(eltype, dst, src, arrays_hashcode_elsize(eltype) * 8);
+void C2_MacroAssembler::arrays_hashcode_elvload(XMMRegister dst, AddressLiteral src, BasicType eltype, int vlen_enc) {
+  const int lanes = (vlen_enc == Assembler::AVX_512bit) ? 16 : 8;
+  load_vector(eltype, dst, src, arrays_hashcode_elsize(eltype) * lanes);
 }
 
-void C2_MacroAssembler::arrays_hashcode_elvcast(XMMRegister dst, BasicType eltype) {
-  const int vlen = Assembler::AVX_256bit;
+void C2_MacroAssembler::arrays_hashcode_elvcast(XMMRegister dst, BasicType eltype, int vlen_enc) {
   switch (eltype) {
-  case T_BOOLEAN: vector_unsigned_cast(dst, dst, vlen, T_BYTE, T_INT);  break;
-  case T_BYTE:      vector_signed_cast(dst, dst, vlen, T_BYTE, T_INT);  break;
-  case T_SHORT:     vector_signed_cast(dst, dst, vlen, T_SHORT, T_INT); break;
-  case T_CHAR:    vector_unsigned_cast(dst, dst, vlen, T_SHORT, T_INT); break;
+  case T_BOOLEAN: vector_unsigned_cast(dst, dst, vlen_enc, T_BYTE, T_INT);  break;
+  case T_BYTE:      vector_signed_cast(dst, dst, vlen_enc, T_BYTE, T_INT);  break;
+  case T_SHORT:     vector_signed_cast(dst, dst, vlen_enc, T_SHORT, T_INT); break;
+  case T_CHAR:    vector_unsigned_cast(dst, dst, vlen_enc, T_SHORT, T_INT); break;
   case T_INT:
     // do nothing
     break;
@@ -3608,6 +3609,79 @@ void C2_MacroAssembler::arrays_hashcode_elvcast(XMMRegister dst, BasicType eltyp
   }
 }
 
+// Unrolled vector loop over the first (cnt1 & ~(stride - 1)) elements, where
+// stride = 4 accumulators * lanes. Requires cnt1 >= stride. On exit ary1 and
+// cnt1 are advanced past the processed elements and result holds the hash of
+// everything seen so far, so vector loops of different widths can be chained.
+void C2_MacroAssembler::arrays_hashcode_vloop(Register ary1, Register cnt1, Register result,
+                                              Register index, Register tmp2, Register tmp3, XMMRegister vnext,
+                                              const XMMRegister vcoef[], const XMMRegister vresult[], const XMMRegister vtmp[],
+                                              BasicType eltype, int vlen_enc) {
+  Label UNROLLED_VECTOR_LOOP_BEGIN;
+
+  const int elsize = arrays_hashcode_elsize(eltype);
+  const int lanes  = (vlen_enc == Assembler::AVX_512bit) ? 16 : 8;
+  const int stride = 4 * lanes;
+  // The powers-of-31 table holds 31^64 down to 31^0; start at 31^stride.
+  const int table_base = 64 - stride;
+
+  xorl(index, index);
+
+  // vresult = IntVector.zero(species);
+  // (the VEX encoded xor also clears the upper half of a 512-bit register)
+  for (int idx = 0; idx < 4; idx++) {
+    vpxor(vresult[idx], vresult[idx]);
+  }
+  // vnext = IntVector.broadcast(species, power_of_31_backwards[0]);
+  Register bound = tmp2;
+  Register next = tmp3;
+  lea(tmp2, ExternalAddress(StubRoutines::x86::arrays_hashcode_powers_of_31() + (table_base * sizeof(jint))));
+  movl(next, Address(tmp2, 0));
+  movdl(vnext, next);
+  vpbroadcastd(vnext, vnext, vlen_enc);
+
+  // index = 0;
+  // bound = cnt1 & ~(stride - 1);
+  movl(bound, cnt1);
+  andl(bound, ~(stride - 1));
+  // for (; index < bound; index += stride) {
+  bind(UNROLLED_VECTOR_LOOP_BEGIN);
+  // result *= next;
+  imull(result, next);
+  // loop fission to upfront the cost of fetching from memory, OOO execution
+  // can then hopefully do a better job of prefetching
+  for (int idx = 0; idx < 4; idx++) {
+    arrays_hashcode_elvload(vtmp[idx], Address(ary1, index, Address::times(elsize), lanes * idx * elsize), eltype, vlen_enc);
+  }
+  // vresult = vresult * vnext + ary1[index+lanes*idx:index+lanes*idx+lanes-1];
+  for (int idx = 0; idx < 4; idx++) {
+    vpmulld(vresult[idx], vresult[idx], vnext, vlen_enc);
+    arrays_hashcode_elvcast(vtmp[idx], eltype, vlen_enc);
+    vpaddd(vresult[idx], vresult[idx], vtmp[idx], vlen_enc);
+  }
+  // index += stride;
+  addl(index, stride);
+  // index < bound;
+  cmpl(index, bound);
+  jcc(Assembler::less, UNROLLED_VECTOR_LOOP_BEGIN);
+  // }
+
+  lea(ary1, Address(ary1, bound, Address::times(elsize)));
+  subl(cnt1, bound);
+  // release bound
+
+  // vresult *= IntVector.fromArray(species, power_of_31_backwards, 1);
+  for (int idx = 0; idx < 4; idx++) {
+    lea(tmp2, ExternalAddress(StubRoutines::x86::arrays_hashcode_powers_of_31() + ((table_base + lanes * idx + 1) * sizeof(jint))));
+    arrays_hashcode_elvload(vcoef[idx], Address(tmp2, 0), T_INT, vlen_enc);
+    vpmulld(vresult[idx], vresult[idx], vcoef[idx], vlen_enc);
+  }
+  // result += vresult.reduceLanes(ADD);
+  for (int idx = 0; idx < 4; idx++) {
+    reduceI(Op_AddReductionVI, lanes, result, result, vresult[idx], vtmp[(idx * 2 + 0) % 4], vtmp[(idx * 2 + 1) % 4]);
+  }
+}
+
 void C2_MacroAssembler::arrays_hashcode(Register ary1, Register cnt1, Register result,
                                         Register index, Register tmp2, Register tmp3, XMMRegister vnext,
                                         XMMRegister vcoef0, XMMRegister vcoef1, XMMRegister vcoef2, XMMRegister vcoef3,
@@ -3621,8 +3695,7 @@ void C2_MacroAssembler::arrays_hashcode(Register ary1, Register cnt1, Register r
 
   Label SHORT_UNROLLED_BEGIN, SHORT_UNROLLED_LOOP_BEGIN,
         SHORT_UNROLLED_LOOP_EXIT,
-        UNROLLED_SCALAR_LOOP_BEGIN, UNROLLED_SCALAR_SKIP, UNROLLED_SCALAR_RESUME,
-        UNROLLED_VECTOR_LOOP_BEGIN,
+        VECTOR256_BEGIN,
         END;
   switch (eltype) {
   case T_BOOLEAN: BLOCK_COMMENT("arrays_hashcode(unsigned byte) {"); break;
@@ -3642,72 +3715,31 @@ void C2_MacroAssembler::arrays_hashcode(Register ary1, Register cnt1, Register r
 
   /*
     if (cnt1 >= 2) {
+      if (cnt1 >= 64 && UseAVX > 2) {
+        UNROLLED VECTOR LOOP (512-bit)
+      }
       if (cnt1 >= 32) {
-        UNROLLED VECTOR LOOP
+        UNROLLED VECTOR LOOP (256-bit)
       }
       UNROLLED SCALAR LOOP
     }
     SINGLE SCALAR
    */
 
+  if (UseAVX > 2) {
+    cmpl(cnt1, 64);
+    jcc(Assembler::less, VECTOR256_BEGIN);
+    arrays_hashcode_vloop(ary1, cnt1, result, index, tmp2, tmp3, vnext,
+                          vcoef, vresult, vtmp, eltype, Assembler::AVX_512bit);
+    bind(VECTOR256_BEGIN);
+  }
+
   cmpl(cnt1, 32);
   jcc(Assembler::less, SHORT_UNROLLED_BEGIN);
 
   // cnt1 >= 32 && generate_vectorized_loop
-  xorl(index, index);
-
-  // vresult = IntVector.zero(I256);
-  for (int idx = 0; idx < 4; idx++) {
-    vpxor(vresult[idx], vresult[idx]);
-  }
-  // vnext = IntVector.broadcast(I256, power_of_31_backwards[0]);
-  Register bound = tmp2;
-  Register next = tmp3;
-  lea(tmp2, ExternalAddress(StubRoutines::x86::arrays_hashcode_powers_of_31() + (0 * sizeof(jint))));
-  movl(next, Address(tmp2, 0));
-  movdl(vnext, next);
-  vpbroadcastd(vnext, vnext, Assembler::AVX_256bit);
-
-  // index = 0;
-  // bound = cnt1 & ~(32 - 1);
-  movl(bound, cnt1);
-  andl(bound, ~(32 - 1));
-  // for (; index < bound; index += 32) {
-  bind(UNROLLED_VECTOR_LOOP_BEGIN);
-  // result *= next;
-  imull(result, next);
-  // loop fission to upfront the cost of fetching from memory, OOO execution
-  // can then hopefully do a better job of prefetching
-  for (int idx = 0; idx < 4; idx++) {
-    arrays_hashcode_elvload(vtmp[idx], Address(ary1, index, Address::times(elsize), 8 * idx * elsize), eltype);
-  }
-  // vresult = vresult * vnext + ary1[index+8*idx:index+8*idx+7];
-  for (int idx = 0; idx < 4; idx++) {
-    vpmulld(vresult[idx], vresult[idx], vnext, Assembler::AVX_256bit);
-    arrays_hashcode_elvcast(vtmp[idx], eltype);
-    vpaddd(vresult[idx], vresult[idx], vtmp[idx], Assembler::AVX_256bit);
-  }
-  // index += 32;
-  addl(index, 32);
-  // index < bound;
-  cmpl(index, bound);
-  jcc(Assembler::less, UNROLLED_VECTOR_LOOP_BEGIN);
-  // }
-
-  lea(ary1, Address(ary1, bound, Address::times(elsize)));
-  subl(cnt1, bound);
-  // release bound
-
-  // vresult *= IntVector.fromArray(I256, power_of_31_backwards, 1);
-  for (int idx = 0; idx < 4; idx++) {
-    lea(tmp2, ExternalAddress(StubRoutines::x86::arrays_hashcode_powers_of_31() + ((8 * idx + 1) * sizeof(jint))));
-    arrays_hashcode_elvload(vcoef[idx], Address(tmp2, 0), T_INT);
-    vpmulld(vresult[idx], vresult[idx], vcoef[idx], Assembler::AVX_256bit);
-  }
-  // result += vresult.reduceLanes(ADD);
-  for (int idx = 0; idx < 4; idx++) {
-    reduceI(Op_AddReductionVI, 256/(sizeof(jint) * 8), result, result, vresult[idx], vtmp[(idx * 2 + 0) % 4], vtmp[(idx * 2 + 1) % 4]);
-  }
+  arrays_hashcode_vloop(ary1, cnt1, result, index, tmp2, tmp3, vnext,
+                        vcoef, vresult, vtmp, eltype, Assembler::AVX_256bit);
 
   // } else if (cnt1 < 32) {
 
@@ -303,9 +303,13 @@
   // helper functions for arrays_hashcode
   int arrays_hashcode_elsize(BasicType eltype);
   void arrays_hashcode_elload(Register dst, Address src, BasicType eltype);
-  void arrays_hashcode_elvload(XMMRegister dst, Address src, BasicType eltype);
-  void arrays_hashcode_elvload(XMMRegister dst, AddressLiteral src, BasicType eltype);
-  void arrays_hashcode_elvcast(XMMRegister dst, BasicType eltype);
+  void arrays_hashcode_elvload(XMMRegister dst, Address src, BasicType eltype, int vlen_enc = Assembler::AVX_256bit);
+  void arrays_hashcode_elvload(XMMRegister dst, AddressLiteral src, BasicType eltype, int vlen_enc = Assembler::AVX_256bit);
+  void arrays_hashcode_elvcast(XMMRegister dst, BasicType eltype, int vlen_enc = Assembler::AVX_256bit);
+  void arrays_hashcode_vloop(Register ary1, Register cnt1, Register result,
+                             Register index, Register tmp2, Register tmp3, XMMRegister vnext,
+                             const XMMRegister vcoef[], const XMMRegister vresult[], const XMMRegister vtmp[],
+                             BasicType eltype, int vlen_enc);
 
   void convertF2I(BasicType dst_bt, BasicType src_bt, Register dst, XMMRegister src);
 
@@ -142,8 +142,9 @@ void DowncallLinker::StubGenerator::generate() {
   allocated_frame_size += _abi._shadow_space_bytes;
   allocated_frame_size += ForeignGlobals::compute_out_arg_bytes(_input_registers);
 
-  // when we don't use a return buffer we need to spill the return value around our slow path calls
-  bool should_save_return_value = !_needs_return_buffer;
+  // when we don't use a return buffer we need to spill the return value around our slow path calls.
+  // A critical call without state capture has no such calls, so no spill area is needed.
+  bool should_save_return_value = !_needs_return_buffer && (_needs_transition || _captured_state_mask != 0);
   RegSpiller out_reg_spiller(_output_registers);
   int spill_rsp_offset = -1;
 
@@ -178,6 +178,12 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  product(size_t, UnsafeSetMemoryNonTemporalThreshold, 4*M, DIAGNOSTIC,     \
+             "Minimum size in bytes of an 8-byte aligned Unsafe.setMemory " \
+             "fill to use non-temporal stores, which bypass the caches. "   \
+             "0 disables non-temporal stores.")                             \
+             range(0, max_uintx)                                            \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")                       \
@@ -1274,11 +1274,25 @@ void InterpreterMacroAssembler::set_mdp_data_at(Register mdp_in,
 }
 
 
+// With InterpreterProfileSampleRate > 1, counters passed as sampled (call and
+// type check counts) are updated by the sample rate, on average once in every
+// InterpreterProfileSampleRate such updates of the thread. Branch, switch and
+// ret counters are never sampled: C2 prunes paths it believes were never taken.
 void InterpreterMacroAssembler::increment_mdp_data_at(Register mdp_in,
-                                                      int constant) {
+                                                      int constant,
+                                                      bool sampled) {
   assert(ProfileInterpreter, "must be profiling interpreter");
   Address data(mdp_in, constant);
-  addptr(data, DataLayout::counter_increment);
+  if (sampled && InterpreterProfileSampleRate > 1) {
+    Label not_sampled;
+    assert_different_registers(mdp_in, rscratch1);
+    Address countdown(r15_thread, JavaThread::interpreter_profile_countdown_offset());
+    profile_sample(countdown, InterpreterProfileSampleRate, rscratch1, not_sampled);
+    addptr(data, DataLayout::counter_increment * (int)InterpreterProfileSampleRate);
+    bind(not_sampled);
+  } else {
+    addptr(data, DataLayout::counter_increment);
+  }
 }
 
 
@@ -1397,7 +1411,7 @@ void InterpreterMacroAssembler::profile_call(Register mdp) {
     test_method_data_pointer(mdp, profile_continue);
 
     // We are making a call.  Increment the count.
-    increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()));
+    increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()), true);
 
     // The method data pointer needs to be updated to reflect the new target.
     update_mdp_by_constant(mdp, in_bytes(CounterData::counter_data_size()));
@@ -1414,7 +1428,7 @@ void InterpreterMacroAssembler::profile_final_call(Register mdp) {
     test_method_data_pointer(mdp, profile_continue);
 
     // We are making a call.  Increment the count.
-    increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()));
+    increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()), true);
 
     // The method data pointer needs to be updated to reflect the new target.
     update_mdp_by_constant(mdp,
@@ -1441,7 +1455,7 @@ void InterpreterMacroAssembler::profile_virtual_call(Register receiver,
       testptr(receiver, receiver);
       jccb(Assembler::notZero, not_null);
       // We are making a call.  Increment the count for null receiver.
-      increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()));
+      increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()), true);
       jmp(skip_receiver_profile);
       bind(not_null);
     }
@@ -1472,7 +1486,7 @@ void InterpreterMacroAssembler::record_klass_in_profile_helper(
                                         Register reg2, int start_row,
                                         Label& done, bool is_virtual_call) {
   if (TypeProfileWidth == 0) {
-    increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()));
+    increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()), true);
   } else {
     record_item_in_profile_helper(receiver, mdp, reg2, 0, done, TypeProfileWidth,
                                   &VirtualCallData::receiver_offset, &VirtualCallData::receiver_count_offset);
@@ -1504,7 +1518,7 @@ void InterpreterMacroAssembler::record_item_in_profile_helper(Register item, Reg
 
     // The item is item[n].  Increment count[n].
     int count_offset = in_bytes(item_count_offset_fn(row));
-    increment_mdp_data_at(mdp, count_offset);
+    increment_mdp_data_at(mdp, count_offset, true);
     jmp(done);
     bind(next_test);
 
@@ -1517,7 +1531,7 @@ void InterpreterMacroAssembler::record_item_in_profile_helper(Register item, Reg
         jccb(Assembler::zero, found_null);
         // Item did not match any saved item and there is no empty row for it.
         // Increment total counter to indicate polymorphic case.
-        increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()));
+        increment_mdp_data_at(mdp, in_bytes(CounterData::count_offset()), true);
         jmp(done);
         bind(found_null);
         break;
@@ -872,6 +872,28 @@ void MacroAssembler::atomic_incl(AddressLiteral counter_addr, Register rscratch)
   }
 }
 
+// The countdown is re-armed with a pseudo-random value in [0, 2 * rate - 2],
+// so a sample is taken on average once every rate events. A fixed stride
+// would lock step with the control flow of a loop: with k profiled sites per
+// iteration and gcd(k, rate) > 1 some of the sites would never be sampled.
+// The value is drawn from a per-thread linear congruential generator, using
+// the high bits of the state only.
+void MacroAssembler::profile_sample(Address countdown, uint rate, Register tmp, Label& not_sampled) {
+  assert(rate > 1 && rate <= 1024, "sample rate out of range");
+  assert_different_registers(tmp, countdown.base(), countdown.index());
+  decrementl(countdown);
+  jcc(Assembler::positive, not_sampled);
+  Address seed(r15_thread, JavaThread::profile_sample_seed_offset());
+  movl(tmp, seed);
+  imull(tmp, tmp, 1103515245);
+  addl(tmp, 12345);
+  movl(seed, tmp);
+  shrl(tmp, 16);
+  imull(tmp, tmp, (int)(2 * rate - 1));
+  shrl(tmp, 16);
+  movl(countdown, tmp);
+}
+
 void MacroAssembler::atomic_incq(Address counter_addr) {
   lock();
   incrementq(counter_addr);
@@ -853,6 +853,12 @@ class MacroAssembler: public Assembler {
   void atomic_incptr(AddressLiteral counter_addr, Register rscratch = noreg) { atomic_incq(counter_addr, rscratch); }
   void atomic_incptr(Address counter_addr) { atomic_incq(counter_addr); }
 
+  // Sampling of profile counter updates. Decrements the thread local
+  // countdown and jumps to not_sampled while it stays non-negative.
+  // Otherwise re-arms the countdown from the thread's sampling seed.
+  // Kills tmp and the condition codes.
+  void profile_sample(Address countdown, uint rate, Register tmp, Label& not_sampled);
+
   using Assembler::lea;
   void lea(Register dst, AddressLiteral adr);
   void lea(Address  dst, AddressLiteral adr, Register rscratch);
@@ -2665,13 +2665,17 @@ address StubGenerator::generate_unsafe_copy(address byte_copy_entry, address sho
 enum USM_TYPE {USM_SHORT, USM_DWORD, USM_QUADWORD};
 // Helper for generate_unsafe_setmemory
 //
-// Atomically fill an array of memory using 2-, 4-, or 8-byte chunks
+// Atomically fill an array of memory using 2-, 4-, or 8-byte chunks.
+// Quadword fills can use non-temporal stores; the caller must sfence.
 static void do_setmemory_atomic_loop(USM_TYPE type, Register dest,
                                      Register size, Register wide_value,
                                      Register tmp, Label& L_exit,
-                                     MacroAssembler *_masm) {
+                                     MacroAssembler *_masm,
+                                     bool non_temporal = false) {
   Label L_Loop, L_Tail, L_TailLoop;
 
+  assert(!non_temporal || type == USM_QUADWORD, "only quadword fills are non-temporal");
+
   int shiftval = 0;
   int incr = 0;
 
@@ -2711,7 +2715,11 @@ static void do_setmemory_atomic_loop(USM_TYPE type, Register dest,
         __ movl(Address(dest, (4 * i)), wide_value);
         break;
       case USM_QUADWORD:
-        __ movq(Address(dest, (8 * i)), wide_value);
+        if (non_temporal) {
+          __ movntiq(Address(dest, (8 * i)), wide_value);
+        } else {
+          __ movq(Address(dest, (8 * i)), wide_value);
+        }
         break;
     }
   }
@@ -2737,7 +2745,11 @@ static void do_setmemory_atomic_loop(USM_TYPE type, Register dest,
         __ movl(Address(dest, 0), wide_value);
         break;
       case USM_QUADWORD:
-        __ movq(Address(dest, 0), wide_value);
+        if (non_temporal) {
+          __ movntiq(Address(dest, 0), wide_value);
+        } else {
+          __ movq(Address(dest, 0), wide_value);
+        }
         break;
     }
   __ addq(dest, incr >> 3);
@@ -2822,6 +2834,21 @@ address StubGenerator::generate_unsafe_setmemory(address unsafe_byte_fill) {
 
       // At this point, we know the lower 3 bits of size are zero and a
       // multiple of 8
+      if (UnsafeSetMemoryNonTemporalThreshold > 0) {
+        // Large fills use non-temporal stores so that they don't evict
+        // the working set from the caches.
+        Label L_temporal, L_sfence;
+        __ mov64(rScratch1, UnsafeSetMemoryNonTemporalThreshold);
+        __ cmpq(size, rScratch1);
+        __ jcc(Assembler::below, L_temporal);
+        do_setmemory_atomic_loop(USM_QUADWORD, dest, size, wide_value, rScratch1,
+                                 L_sfence, _masm, true /* non_temporal */);
+        __ BIND(L_sfence);
+        // Order the weakly-ordered non-temporal stores before later stores
+        __ sfence();
+        __ jmp(L_exit);
+        __ BIND(L_temporal);
+      }
       do_setmemory_atomic_loop(USM_QUADWORD, dest, size, wide_value, rScratch1,
                                L_exit, _masm);
     }
@@ -193,6 +193,38 @@ const juint StubRoutines::x86::_shuf_table_crc32_avx512[] =
 
 const jint StubRoutines::x86::_arrays_hashcode_powers_of_31[] =
 {
+     1304393729,
+     2120287199,
+     -208698303,
+    -1807847521,
+    -1166696319,
+      100911967,
+      280349889,
+    -1930619105,
+      630458625,
+       20337375,
+      693392705,
+      438009503,
+    -1925533311,
+      769170015,
+     1133190593,
+     -240540129,
+       -7759359,
+      969581023,
+     1970939457,
+    -1183347297,
+    -1700740479,
+    -1024693921,
+     -448696639,
+      124073247,
+    -1935660287,
+     1461579999,
+     -922683583,
+     1632803999,
+      329765761,
+     1950300255,
+     1725480897,
+     1025491999,
      2111290369,
     -2010103841,
       350799937,
@@ -862,7 +862,12 @@ jlong CgroupSubsystem::memory_throttle_limit_in_bytes() {
 }
 
 jlong CgroupSubsystem::memory_usage_in_bytes() {
-  return memory_controller()->controller()->memory_usage_in_bytes();
+  if (!_memory_usage_cache.should_check_metric()) {
+    return _memory_usage_cache.value();
+  }
+  jlong mem_usage = memory_controller()->controller()->memory_usage_in_bytes();
+  _memory_usage_cache.set_value(mem_usage, OSCONTAINER_CACHE_TIMEOUT);
+  return mem_usage;
 }
 
 jlong CgroupSubsystem::memory_max_usage_in_bytes() {
@@ -250,6 +250,11 @@ class CgroupMemoryController: public CHeapObj<mtInternal> {
 };
 
 class CgroupSubsystem: public CHeapObj<mtInternal> {
+  private:
+    // memory usage is polled by os::available_memory() from GC ergonomics,
+    // JFR and management code; a short lived cache saves the file reads.
+    CachedMetric _memory_usage_cache;
+
   public:
     jlong memory_limit_in_bytes();
     int active_processor_count();
@@ -22,6 +22,7 @@
  */
 
 #include "gc/shared/gcLogPrecious.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zArray.inline.hpp"
 #include "gc/z/zErrno.hpp"
@@ -81,6 +82,11 @@
 #define FALLOC_FL_PUNCH_HOLE             0x02
 #endif
 
+// madvise(2) advice
+#ifndef MADV_COLLAPSE
+#define MADV_COLLAPSE                    25
+#endif
+
 // Filesystem types, see statfs(2)
 #ifndef TMPFS_MAGIC
 #define TMPFS_MAGIC                      0x01021994
@@ -117,6 +123,7 @@ static const char* ZPreferredHugetlbfsMountpoints[] = {
 };
 
 static int z_fallocate_hugetlbfs_attempts = 3;
+static bool z_madvise_collapse_supported = true;
 static bool z_fallocate_supported = true;
 
 ZPhysicalMemoryBacking::ZPhysicalMemoryBacking(size_t max_capacity)
@@ -439,6 +446,28 @@ static bool safe_touch_mapping(void* addr, size_t length, size_t page_size) {
   return true;
 }
 
+void ZPhysicalMemoryBacking::collapse_transparent_huge_pages(void* addr, size_t length) const {
+  if (!ZCollapseTransparentHugePages || !ZLargePages::is_transparent() || !z_madvise_collapse_supported) {
+    return;
+  }
+
+  // If no huge page was available when the mapping was touched, the kernel
+  // falls back to small pages and leaves it to khugepaged to collapse them
+  // later. Collapse them right away instead, so that every granule is backed
+  // by a huge page from the start. A failed collapse (EAGAIN, ENOMEM) is not
+  // an error, the memory is still backed by small pages.
+  if (::madvise(addr, length, MADV_COLLAPSE) == -1) {
+    ZErrno err;
+    if (err == EINVAL) {
+      // Not supported by the kernel (requires Linux 6.1 or later)
+      log_debug_p(gc)("Collapsing of transparent huge pages not supported");
+      z_madvise_collapse_supported = false;
+    } else {
+      log_debug(gc)("Failed to collapse transparent huge pages (%s)", err.to_string());
+    }
+  }
+}
+
 ZErrno ZPhysicalMemoryBacking::fallocate_compat_mmap_tmpfs(zbacking_offset offset, size_t length) const {
   // On tmpfs, we need to touch the mapped pages to figure out
   // if there are enough pages available to back the mapping.
@@ -456,6 +485,11 @@ ZErrno ZPhysicalMemoryBacking::fallocate_compat_mmap_tmpfs(zbacking_offset offse
   // Touch the mapping (safely) to make sure it's backed by memory
   const bool backed = safe_touch_mapping(addr, length, _block_size);
 
+  // Maybe collapse the parts that the kernel had to back with small pages
+  if (backed) {
+    collapse_transparent_huge_pages(addr, length);
+  }
+
   // Unmap again. If successfully touched, the backing memory will
   // be allocated to this file. There's no risk of getting a SIGBUS
   // when mapping and touching these pages again.
@@ -49,6 +49,7 @@ class ZPhysicalMemoryBacking {
   bool tmpfs_supports_transparent_huge_pages() const;
 
   ZErrno fallocate_compat_mmap_hugetlbfs(zbacking_offset offset, size_t length, bool touch) const;
+  void collapse_transparent_huge_pages(void* addr, size_t length) const;
   ZErrno fallocate_compat_mmap_tmpfs(zbacking_offset offset, size_t length) const;
   ZErrno fallocate_compat_pwrite(zbacking_offset offset, size_t length) const;
   ZErrno fallocate_fill_hole_compat(zbacking_offset offset, size_t length) const;
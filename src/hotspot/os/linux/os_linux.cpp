@@ -824,6 +824,17 @@ static void *thread_native_entry(Thread *thread) {
 
   thread->initialize_thread_current();
 
+  if (THPStackMitigation) {
+    // The guard page set up in default_guard_size() keeps adjacent stacks from
+    // being merged, but khugepaged may still collapse the pages of a single
+    // large stack. Opt the whole stack out of THP formation.
+    address low = align_up(thread->stack_end(), os::vm_page_size());
+    address high = align_down(thread->stack_base(), os::vm_page_size());
+    if (low < high) {
+      os::Linux::madvise_no_transparent_huge_pages(low, pointer_delta(high, low, 1));
+    }
+  }
+
   OSThread* osthread = thread->osthread();
   Monitor* sync = osthread->startThread_lock();
 
@@ -2857,6 +2868,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_NOHUGEPAGE here so we can build HotSpot on old systems.
+#ifndef MADV_NOHUGEPAGE
+  #define MADV_NOHUGEPAGE 15
+#endif
+
 // Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
 #define MADV_POPULATE_WRITE_value 23
 #ifndef MADV_POPULATE_WRITE
@@ -2908,6 +2924,11 @@ void os::Linux::madvise_transparent_huge_pages(void* addr, size_t bytes) {
   ::madvise(addr, bytes, MADV_HUGEPAGE);
 }
 
+void os::Linux::madvise_no_transparent_huge_pages(void* addr, size_t bytes) {
+  // Best effort, as above. Fails harmlessly on kernels without THP support.
+  ::madvise(addr, bytes, MADV_NOHUGEPAGE);
+}
+
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   if (Linux::should_madvise_anonymous_thps() && alignment_hint > vm_page_size()) {
     Linux::madvise_transparent_huge_pages(addr, bytes);
@@ -5007,14 +5028,18 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
 
+  // Read the file with a single read(2): M&M may call this for every
+  // thread, and stdio would allocate and fstat for each of them.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = os::fopen(proc_name, "r");
-  if (fp == nullptr) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  int fd = ::open(proc_name, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) return -1;
+  ssize_t res;
+  RESTARTABLE(::read(fd, stat, sizeof(stat) - 1), res);
+  ::close(fd);
+  if (res < 0) return -1;
+  statlen = (size_t)res;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
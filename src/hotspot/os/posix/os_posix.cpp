@@ -1916,6 +1916,16 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+  // Optional fast-path check:
+  // Return immediately if a permit is already available, as permits do not
+  // accumulate. This avoids contending for _mutex when several threads
+  // unpark the same thread. The fence orders the caller's preceding stores
+  // before the load of _counter. It pairs with the full barriers that follow
+  // every reset of _counter in park(), so a parker that consumes the permit
+  // after we have seen it is guaranteed to also see those stores.
+  OrderAccess::fence();
+  if (Atomic::load(&_counter) > 0) return;
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
@@ -676,17 +676,17 @@ ciKlass* Compilation::cha_exact_type(ciType* type) {
   return nullptr;
 }
 
-void Compilation::print_timers() {
-  tty->print_cr("    C1 Compile Time:      %7.3f s",      timers[_t_compile].seconds());
-  tty->print_cr("       Setup time:          %7.3f s",    timers[_t_setup].seconds());
+void Compilation::print_timers(outputStream* st) {
+  st->print_cr("    C1 Compile Time:      %7.3f s",      timers[_t_compile].seconds());
+  st->print_cr("       Setup time:          %7.3f s",    timers[_t_setup].seconds());
 
   {
-    tty->print_cr("       Build HIR:           %7.3f s",    timers[_t_buildIR].seconds());
-    tty->print_cr("         Parse:               %7.3f s", timers[_t_hir_parse].seconds());
-    tty->print_cr("         Optimize blocks:     %7.3f s", timers[_t_optimize_blocks].seconds());
-    tty->print_cr("         GVN:                 %7.3f s", timers[_t_gvn].seconds());
-    tty->print_cr("         Null checks elim:    %7.3f s", timers[_t_optimize_null_checks].seconds());
-    tty->print_cr("         Range checks elim:   %7.3f s", timers[_t_rangeCheckElimination].seconds());
+    st->print_cr("       Build HIR:           %7.3f s",    timers[_t_buildIR].seconds());
+    st->print_cr("         Parse:               %7.3f s", timers[_t_hir_parse].seconds());
+    st->print_cr("         Optimize blocks:     %7.3f s", timers[_t_optimize_blocks].seconds());
+    st->print_cr("         GVN:                 %7.3f s", timers[_t_gvn].seconds());
+    st->print_cr("         Null checks elim:    %7.3f s", timers[_t_optimize_null_checks].seconds());
+    st->print_cr("         Range checks elim:   %7.3f s", timers[_t_rangeCheckElimination].seconds());
 
     double other = timers[_t_buildIR].seconds() -
       (timers[_t_hir_parse].seconds() +
@@ -695,26 +695,26 @@ void Compilation::print_timers() {
        timers[_t_optimize_null_checks].seconds() +
        timers[_t_rangeCheckElimination].seconds());
     if (other > 0) {
-      tty->print_cr("         Other:               %7.3f s", other);
+      st->print_cr("         Other:               %7.3f s", other);
     }
   }
 
   {
-    tty->print_cr("       Emit LIR:            %7.3f s",    timers[_t_emit_lir].seconds());
-    tty->print_cr("         LIR Gen:             %7.3f s",   timers[_t_lirGeneration].seconds());
-    tty->print_cr("         Linear Scan:         %7.3f s",   timers[_t_linearScan].seconds());
-    NOT_PRODUCT(LinearScan::print_timers(timers[_t_linearScan].seconds()));
+    st->print_cr("       Emit LIR:            %7.3f s",    timers[_t_emit_lir].seconds());
+    st->print_cr("         LIR Gen:             %7.3f s",   timers[_t_lirGeneration].seconds());
+    st->print_cr("         Linear Scan:         %7.3f s",   timers[_t_linearScan].seconds());
+    NOT_PRODUCT(LinearScan::print_timers(st, timers[_t_linearScan].seconds()));
 
     double other = timers[_t_emit_lir].seconds() -
       (timers[_t_lirGeneration].seconds() +
        timers[_t_linearScan].seconds());
     if (other > 0) {
-      tty->print_cr("         Other:               %7.3f s", other);
+      st->print_cr("         Other:               %7.3f s", other);
     }
   }
 
-  tty->print_cr("       Code Emission:       %7.3f s",    timers[_t_codeemit].seconds());
-  tty->print_cr("       Code Installation:   %7.3f s",    timers[_t_codeinstall].seconds());
+  st->print_cr("       Code Emission:       %7.3f s",    timers[_t_codeemit].seconds());
+  st->print_cr("       Code Installation:   %7.3f s",    timers[_t_codeinstall].seconds());
 
   double other = timers[_t_compile].seconds() -
       (timers[_t_setup].seconds() +
@@ -723,7 +723,7 @@ void Compilation::print_timers() {
        timers[_t_codeemit].seconds() +
        timers[_t_codeinstall].seconds());
   if (other > 0) {
-    tty->print_cr("       Other:               %7.3f s", other);
+    st->print_cr("       Other:               %7.3f s", other);
   }
 
   NOT_PRODUCT(LinearScan::print_statistics());
@@ -222,7 +222,7 @@ class Compilation: public StackObj {
   static bool setup_code_buffer(CodeBuffer* cb, int call_stub_estimate);
 
   // timers
-  static void print_timers();
+  static void print_timers(outputStream* st);
 
   bool is_profiling() {
     return env()->comp_level() == CompLevel_full_profile ||
@@ -264,6 +264,6 @@ void Compiler::compile_method(ciEnv* env, ciMethod* method, int entry_bci, bool
 }
 
 
-void Compiler::print_timers() {
-  Compilation::print_timers();
+void Compiler::print_timers(outputStream* st) {
+  Compilation::print_timers(st);
 }
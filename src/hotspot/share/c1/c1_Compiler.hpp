@@ -51,7 +51,7 @@ class Compiler: public AbstractCompiler {
   virtual void compile_method(ciEnv* env, ciMethod* target, int entry_bci, bool install_code, DirectiveSet* directive);
 
   // Print compilation timers and statistics
-  virtual void print_timers();
+  virtual void print_timers(outputStream* st);
 
   // Check if the C1 compiler supports an intrinsic for 'method'.
   virtual bool is_intrinsic_supported(const methodHandle& method);
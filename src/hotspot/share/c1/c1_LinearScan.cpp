@@ -1762,6 +1762,14 @@ void LinearScan::resolve_find_insert_pos(BlockBegin* from_block, BlockBegin* to_
 void LinearScan::resolve_data_flow() {
   TIME_LINEAR_SCAN(timer_resolve_data_flow);
 
+  if (_new_intervals_from_allocation == nullptr) {
+    // no interval was split during allocation, so every interval has the same
+    // location at the end of each block and at the start of all its successors.
+    // This is the common case for small methods; there is nothing to resolve.
+    TRACE_LINEAR_SCAN(2, tty->print_cr("no split intervals, skipping resolution of data flow"));
+    return;
+  }
+
   int num_blocks = block_count();
   MoveResolver move_resolver(this);
   ResourceBitMap block_completed(num_blocks);
@@ -3077,8 +3085,8 @@ void LinearScan::do_linear_scan() {
 
 #ifndef PRODUCT
 
-void LinearScan::print_timers(double total) {
-  _total_timer.print(total);
+void LinearScan::print_timers(outputStream* st, double total) {
+  _total_timer.print(st, total);
 }
 
 void LinearScan::print_statistics() {
@@ -6724,7 +6732,7 @@ const char* LinearScanTimers::timer_name(int idx) {
   }
 }
 
-void LinearScanTimers::print(double total_time) {
+void LinearScanTimers::print(outputStream* st, double total_time) {
   if (TimeLinearScan) {
     // correction value: sum of dummy-timer that only measures the time that
     // is necessary to start and stop itself
@@ -6732,7 +6740,7 @@ void LinearScanTimers::print(double total_time) {
 
     for (int i = 0; i < number_of_timers; i++) {
       double t = timer(i)->seconds();
-      tty->print_cr("    %25s: %6.3f s (%4.1f%%)  corrected: %6.3f s (%4.1f%%)", timer_name(i), t, (t / total_time) * 100.0, t - c, (t - c) / (total_time - 2 * number_of_timers * c) * 100);
+      st->print_cr("    %25s: %6.3f s (%4.1f%%)  corrected: %6.3f s (%4.1f%%)", timer_name(i), t, (t / total_time) * 100.0, t - c, (t - c) / (total_time - 2 * number_of_timers * c) * 100);
     }
   }
 }
@@ -381,7 +381,7 @@ class LinearScan : public CompilationResourceObj {
 #ifndef PRODUCT
   // entry functions for printing
   static void print_statistics();
-  static void print_timers(double total);
+  static void print_timers(outputStream* st, double total);
 
   // Used for debugging
   Interval* find_interval_at(int reg_num) const;
@@ -948,7 +948,7 @@ class LinearScanTimers : public StackObj {
 
  public:
   LinearScanTimers();
-  void print(double total_time);           // called before termination of VM to print global summary
+  void print(outputStream* st, double total_time); // called before termination of VM to print global summary
   elapsedTimer* timer(int idx) { return &(_timers[idx]); }
 };
 
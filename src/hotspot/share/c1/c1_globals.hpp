@@ -293,6 +293,13 @@
   product(bool, C1UpdateMethodData, true,                                   \
           "Update MethodData*s in Tier 3 C1 generated code")                \
                                                                             \
+  product(uint, C1ProfileCallSampleRate, 1, EXPERIMENTAL,                   \
+          "Update call profiles in Tier 3 C1 generated code on average "    \
+          "once in every N profiled calls of a thread, at pseudo-random "   \
+          "intervals, scaling the counter update by N. 1 updates on every " \
+          "call. Only supported on x86_64")                                 \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(bool, PrintCFGToFile, false,                                      \
           "print control flow graph to a separate file during compilation")
 
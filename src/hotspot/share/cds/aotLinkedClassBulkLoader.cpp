@@ -40,6 +40,7 @@
 #include "oops/trainingData.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
+#include "utilities/ticks.hpp"
 
 bool AOTLinkedClassBulkLoader::_boot2_completed = false;
 bool AOTLinkedClassBulkLoader::_platform_completed = false;
@@ -94,12 +95,16 @@ void AOTLinkedClassBulkLoader::load_non_javabase_classes(JavaThread* current) {
 }
 
 void AOTLinkedClassBulkLoader::load_classes_in_loader(JavaThread* current, AOTLinkedClassCategory class_category, oop class_loader_oop) {
+  const Ticks start = Ticks::now();
   load_classes_in_loader_impl(class_category, class_loader_oop, current);
   if (current->has_pending_exception()) {
     // We cannot continue, as we might have loaded some of the aot-linked classes, which
     // may have dangling C++ pointers to other aot-linked classes that we have failed to load.
     exit_on_exception(current);
   }
+  log_info(aot, load)("Loaded aot-linked %s classes in " UINT64_FORMAT " us",
+                      AOTClassLinker::class_category_name(class_category),
+                      (Ticks::now() - start).microseconds());
 }
 
 void AOTLinkedClassBulkLoader::exit_on_exception(JavaThread* current) {
@@ -127,6 +127,7 @@ class ArchiveBuilder : public StackObj {
     uintx _ptrmap_end;       // The bit-offset of the end   of this object (exclusive)
     bool _read_only;
     bool _has_embedded_pointer;
+    bool _is_hot_klass;      // Klass used during training, see sort_metadata_objs()
     FollowMode _follow_mode;
     int _size_in_bytes;
     int _id; // Each object has a unique serial ID, starting from zero. The ID is assigned
@@ -136,7 +137,8 @@ class ArchiveBuilder : public StackObj {
     address _buffered_addr;  // The copy of this object insider the buffer.
   public:
     SourceObjInfo(MetaspaceClosure::Ref* ref, bool read_only, FollowMode follow_mode) :
-      _ptrmap_start(0), _ptrmap_end(0), _read_only(read_only), _has_embedded_pointer(false), _follow_mode(follow_mode),
+      _ptrmap_start(0), _ptrmap_end(0), _read_only(read_only), _has_embedded_pointer(false), _is_hot_klass(false),
+      _follow_mode(follow_mode),
       _size_in_bytes(ref->size() * BytesPerWord), _id(0), _msotype(ref->msotype()),
       _source_addr(ref->obj()) {
       if (follow_mode == point_to_it) {
@@ -150,7 +152,7 @@ class ArchiveBuilder : public StackObj {
     //   src = address of a Method or InstanceKlass that has been regenerated.
     //   renegerated_obj_info = info for the regenerated version of src.
     SourceObjInfo(address src, SourceObjInfo* renegerated_obj_info) :
-      _ptrmap_start(0), _ptrmap_end(0), _read_only(false),
+      _ptrmap_start(0), _ptrmap_end(0), _read_only(false), _is_hot_klass(false),
       _follow_mode(renegerated_obj_info->_follow_mode),
       _size_in_bytes(0), _msotype(renegerated_obj_info->_msotype),
       _source_addr(src),  _buffered_addr(renegerated_obj_info->_buffered_addr) {}
@@ -169,6 +171,8 @@ class ArchiveBuilder : public StackObj {
     bool read_only()      const    { return _read_only;    }
     bool has_embedded_pointer() const { return _has_embedded_pointer; }
     void set_has_embedded_pointer()   { _has_embedded_pointer = true; }
+    bool is_hot_klass()   const    { return _is_hot_klass; }
+    void set_is_hot_klass()        { _is_hot_klass = true; }
     int size_in_bytes()   const    { return _size_in_bytes; }
     int id()              const    { return _id; }
     void set_id(int i)             { _id = i; }
@@ -420,6 +424,8 @@ class ArchiveBuilder : public StackObj {
   char* ro_strdup(const char* s);
 
   static int compare_src_objs(SourceObjInfo** a, SourceObjInfo** b);
+  static int compare_src_objs_hot_klasses_first(SourceObjInfo** a, SourceObjInfo** b);
+  int mark_hot_klasses(SourceObjList* src_objs);
   void sort_metadata_objs();
   void dump_rw_metadata();
   void dump_ro_metadata();
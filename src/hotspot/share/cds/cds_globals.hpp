@@ -150,6 +150,10 @@
   product(bool, AOTCompileEagerly, false, EXPERIMENTAL,                     \
           "Compile methods as soon as possible")                            \
                                                                             \
+  product(bool, AOTClusterHotKlasses, false, DIAGNOSTIC,                    \
+          "When assembling the AOT cache, place the classes that were "     \
+          "used during training next to each other in the class space")     \
+                                                                            \
   /* AOT Code flags */                                                      \
                                                                             \
   product(bool, AOTAdapterCaching, false, DIAGNOSTIC,                       \
@@ -44,6 +44,7 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
+#include "gc/shared/gcConfig.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "logging/logMessage.hpp"
@@ -75,6 +76,7 @@
 #include "utilities/classpathStream.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
 #if INCLUDE_G1GC
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1HeapRegion.hpp"
@@ -1354,6 +1356,7 @@ class SharedDataRelocationTask : public ArchiveWorkerTask {
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
   aot_log_debug(aot, reloc)("runtime archive relocation start");
+  const Ticks start = Ticks::now();
   char* bitmap_base = map_bitmap_region();
 
   if (bitmap_base == nullptr) {
@@ -1400,7 +1403,10 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
-    aot_log_debug(aot, reloc)("runtime archive relocation done");
+    aot_log_debug(aot, reloc)("runtime archive relocation done (%s, %zu + %zu pointer bits, " UINT64_FORMAT " us)",
+                              AOTCacheParallelRelocation ? "parallel" : "serial",
+                              rw_ptrmap.size(), ro_ptrmap.size(),
+                              (Ticks::now() - start).microseconds());
     return true;
   }
 }
@@ -1467,7 +1473,9 @@ void FileMapInfo::map_or_load_heap_region() {
       if (!UseCompressedOops && !ArchiveHeapLoader::can_map()) {
         MetaspaceShared::report_loading_error("Cannot use CDS heap data. Selected GC not compatible -XX:-UseCompressedOops");
       } else {
-        MetaspaceShared::report_loading_error("Cannot use CDS heap data. UseEpsilonGC, UseG1GC, UseSerialGC, UseParallelGC, or UseShenandoahGC are required.");
+        MetaspaceShared::report_loading_error("Cannot use CDS heap data. The selected GC (%s) can neither map nor load archived heap objects. "
+                                              "UseEpsilonGC, UseG1GC, UseSerialGC, UseParallelGC, or non-generational UseShenandoahGC are required.",
+                                              GCConfig::hs_err_name());
       }
     }
   }
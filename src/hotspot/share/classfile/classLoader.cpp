@@ -140,6 +140,9 @@ PerfCounter*    ClassLoader::_perf_resolve_mt_count = nullptr;
 
 void ClassLoader::print_counters(outputStream *st) {
   st->print_cr("ClassLoader:");
+  st->print_cr("  define app classes:   " JLONG_FORMAT "ms / " JLONG_FORMAT " events", Management::ticks_to_ms(_perf_define_appclass_time->get_value()), _perf_define_appclasses->get_value());
+  st->print_cr("  verify:               " JLONG_FORMAT "ms / " JLONG_FORMAT " events", ClassLoader::class_verify_time_ms(), _perf_classes_verified->get_value());
+  st->print_cr("  link:                 " JLONG_FORMAT "ms / " JLONG_FORMAT " events", ClassLoader::class_link_time_ms(), ClassLoader::class_link_count());
   st->print_cr("  clinit:               " JLONG_FORMAT "ms / " JLONG_FORMAT " events", ClassLoader::class_init_time_ms(), ClassLoader::class_init_count());
   st->print_cr("  link methods:         " JLONG_FORMAT "ms / " JLONG_FORMAT " events", Management::ticks_to_ms(_perf_ik_link_methods_time->get_value())   , _perf_ik_link_methods_count->get_value());
   st->print_cr("  method adapters:      " JLONG_FORMAT "ms / " JLONG_FORMAT " events", Management::ticks_to_ms(_perf_method_adapters_time->get_value())   , _perf_method_adapters_count->get_value());
@@ -462,9 +462,13 @@ void ClassLoaderDataGraph::clean_module_and_package_info() {
 }
 
 void ClassLoaderDataGraph::purge(bool at_safepoint) {
-  ClassUnloadingContext::context()->purge_class_loader_data();
+  purge(ClassUnloadingContext::context(), at_safepoint);
+}
+
+void ClassLoaderDataGraph::purge(ClassUnloadingContext* ctx, bool at_safepoint) {
+  ctx->purge_class_loader_data();
 
-  bool classes_unloaded = ClassUnloadingContext::context()->has_unloaded_classes();
+  bool classes_unloaded = ctx->has_unloaded_classes();
 
   Metaspace::purge(classes_unloaded);
   if (classes_unloaded) {
@@ -30,6 +30,8 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 
+class ClassUnloadingContext;
+
 // GC root for walking class loader data created
 
 class ClassLoaderDataGraph : public AllStatic {
@@ -61,6 +63,9 @@ class ClassLoaderDataGraph : public AllStatic {
   static ClassLoaderData* add(Handle class_loader, bool has_class_mirror_holder);
   static void clean_module_and_package_info();
   static void purge(bool at_safepoint);
+  // Purge the class loader data unloaded with the given, possibly no longer
+  // current, class unloading context.
+  static void purge(ClassUnloadingContext* ctx, bool at_safepoint);
   static void clear_claimed_marks();
   static void clear_claimed_marks(int claim);
   static void verify_claimed_marks_cleared(int claim);
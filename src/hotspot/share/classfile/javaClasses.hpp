@@ -175,7 +175,16 @@ class java_lang_String : AllStatic {
   }
 
   static unsigned int hash_code(const jbyte* s, int len) {
+    // Same result as h = 31*h + c over all bytes, but four bytes at a time so
+    // that the multiplications do not form a single serial dependency chain.
     unsigned int h = 0;
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 31*31*31*31*h
+        + 31*31*31*(((unsigned int) s[0]) & 0xFF)
+        +    31*31*(((unsigned int) s[1]) & 0xFF)
+        +       31*(((unsigned int) s[2]) & 0xFF)
+        +          (((unsigned int) s[3]) & 0xFF);
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
@@ -31,7 +31,7 @@
 #include "oops/klass.inline.hpp"
 #include "oops/symbolHandle.hpp"
 #include "runtime/mutexLocker.hpp"
-#include "utilities/resourceHash.hpp"
+#include "utilities/resizeableResourceHash.hpp"
 
 // Overview
 //
@@ -147,7 +147,9 @@ class ConstraintSet {                               // copied into hashtable as
 };
 
 
-using InternalLoaderConstraintTable = ResourceHashtable<SymbolHandle, ConstraintSet, 107, AnyObj::C_HEAP, mtClass, SymbolHandle::compute_hash>;
+const int _loader_constraint_table_size = 107;
+const int _loader_constraint_table_max_size = 20201;
+using InternalLoaderConstraintTable = ResizeableResourceHashtable<SymbolHandle, ConstraintSet, AnyObj::C_HEAP, mtClass, SymbolHandle::compute_hash>;
 static InternalLoaderConstraintTable* _loader_constraint_table;
 
 void LoaderConstraint::extend_loader_constraint(Symbol* class_name,
@@ -174,7 +176,8 @@ void LoaderConstraint::extend_loader_constraint(Symbol* class_name,
 // entries in the table could be being dynamically resized.
 
 void LoaderConstraintTable::initialize() {
-  _loader_constraint_table = new (mtClass) InternalLoaderConstraintTable();
+  _loader_constraint_table = new (mtClass) InternalLoaderConstraintTable(_loader_constraint_table_size,
+                                                                         _loader_constraint_table_max_size);
 }
 
 LoaderConstraint* LoaderConstraintTable::find_loader_constraint(
@@ -213,6 +216,9 @@ void LoaderConstraintTable::add_loader_constraint(Symbol* name, InstanceKlass* k
   ConstraintSet* set = _loader_constraint_table->put_if_absent(name, &created);
   if (created) {
     set->initialize(constraint);
+    // Grow the table as class names are added, so that lookups done under the
+    // SystemDictionary_lock do not walk long bucket chains.
+    _loader_constraint_table->maybe_grow();
   } else {
     set->add_constraint(constraint);
   }
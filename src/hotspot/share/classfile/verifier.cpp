@@ -59,6 +59,7 @@
 #include "services/threadService.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bytes.hpp"
+#include "utilities/ticks.hpp"
 #if INCLUDE_CDS
 #include "classfile/systemDictionaryShared.hpp"
 #endif
@@ -216,6 +217,9 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
   char* message_buffer = nullptr;
   char* exception_message = nullptr;
 
+  LogTarget(Debug, class, init) lt_time;
+  const Ticks start_time = lt_time.is_enabled() ? Ticks::now() : Ticks();
+
   log_info(class, init)("Start class verification for: %s", klass->external_name());
   if (klass->major_version() >= STACKMAP_ATTRIBUTE_MAJOR_VERSION) {
     ClassVerifier split_verifier(jt, klass);
@@ -266,6 +270,11 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
     LogStream ls(lt2);
     log_end_verification(&ls, klass->external_name(), exception_name, PENDING_EXCEPTION);
   }
+  if (lt_time.is_enabled()) {
+    lt_time.print("Verification of %s (%d methods) took " UINT64_FORMAT " us",
+                  klass->external_name(), klass->methods()->length(),
+                  (Ticks::now() - start_time).microseconds());
+  }
 
   if (HAS_PENDING_EXCEPTION) {
     return false; // use the existing exception
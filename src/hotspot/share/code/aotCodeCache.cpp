@@ -35,6 +35,7 @@
 #include "gc/shared/gcConfig.hpp"
 #include "logging/logStream.hpp"
 #include "memory/memoryReserver.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/flags/flagSetting.hpp"
 #include "runtime/globals_extension.hpp"
@@ -243,6 +244,8 @@ void AOTCodeCache::initialize() {
 
 static AOTCodeCache*  opened_cache = nullptr; // Use this until we verify the cache
 AOTCodeCache* AOTCodeCache::_cache = nullptr;
+volatile uint AOTCodeCache::_loaded_counts[AOTCodeEntry::Kind_count] = {};
+volatile uint AOTCodeCache::_missed_counts[AOTCodeEntry::Kind_count] = {};
 DEBUG_ONLY( bool AOTCodeCache::_passed_init2 = false; )
 
 // It is called after universe_init() when all GC settings are finalized.
@@ -382,6 +385,10 @@ AOTCodeCache::~AOTCodeCache() {
   // Stop any further access to cache.
   _closing = true;
 
+  if (for_use()) {
+    print_load_statistics();
+  }
+
   MutexLocker ml(Compile_lock);
   if (for_dump()) { // Finalize cache
     finish_write();
@@ -399,6 +406,17 @@ AOTCodeCache::~AOTCodeCache() {
   }
 }
 
+// How much of the archived code was actually found and installed in this run.
+void AOTCodeCache::print_load_statistics() {
+  log_info(aot, codecache, exit)("AOT Code Cache loads:");
+  for (int kind = AOTCodeEntry::Adapter; kind < AOTCodeEntry::Kind_count; kind++) {
+    log_info(aot, codecache, exit)("  %s: loaded=%u, not found or failed=%u",
+                                   aot_code_entry_kind_name[kind],
+                                   Atomic::load(&_loaded_counts[kind]),
+                                   Atomic::load(&_missed_counts[kind]));
+  }
+}
+
 void AOTCodeCache::Config::record() {
   _flags = 0;
 #ifdef ASSERT
@@ -926,10 +944,12 @@ CodeBlob* AOTCodeCache::load_code_blob(AOTCodeEntry::Kind entry_kind, uint id, c
 
   AOTCodeEntry* entry = cache->find_entry(entry_kind, encode_id(entry_kind, id));
   if (entry == nullptr) {
+    Atomic::inc(&_missed_counts[entry_kind]);
     return nullptr;
   }
   AOTCodeReader reader(cache, entry);
   CodeBlob* blob = reader.compile_code_blob(name, entry_offset_count, entry_offsets);
+  Atomic::inc(blob != nullptr ? &_loaded_counts[entry_kind] : &_missed_counts[entry_kind]);
 
   log_debug(aot, codecache, stubs)("%sRead blob '%s' (id=%u, kind=%s) from AOT Code Cache",
                                    (blob == nullptr? "Failed to " : ""), name, id, aot_code_entry_kind_name[entry_kind]);
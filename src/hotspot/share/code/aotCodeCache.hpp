@@ -364,6 +364,9 @@ class AOTCodeCache : public CHeapObj<mtCode> {
 
 private:
   static AOTCodeCache* _cache;
+  static volatile uint _loaded_counts[AOTCodeEntry::Kind_count];
+  static volatile uint _missed_counts[AOTCodeEntry::Kind_count];
+  static void print_load_statistics();
   DEBUG_ONLY( static bool _passed_init2; )
 
   static bool open_cache(bool is_dumping, bool is_using);
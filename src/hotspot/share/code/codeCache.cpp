@@ -65,6 +65,7 @@
 #include "sanitizers/leak.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/align.hpp"
+#include "utilities/ticks.hpp"
 #include "utilities/vmError.hpp"
 #include "utilities/xmlstream.hpp"
 #ifdef COMPILER1
@@ -439,6 +440,9 @@ void CodeCache::add_heap(ReservedSpace rs, const char* name, CodeBlobType code_b
     vm_exit_during_initialization(err_msg("Could not reserve enough space in %s (%zuK)",
                                           heap->name(), size_initial/K));
   }
+  // Whether the hot (non-profiled) code is on large pages decides most of its iTLB cost.
+  log_info(codecache)("%s: reserved " PROPERFMT " at " PTR_FORMAT " with " PROPERFMT " pages",
+                      heap->name(), PROPERFMTARGS(rs.size()), p2i(rs.base()), PROPERFMTARGS(rs.page_size()));
 
   // Register the CodeHeap
   MemoryService::add_code_heap_memory_pool(heap, name);
@@ -1234,9 +1238,20 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, KlassD
   // nmethod::check_all_dependencies works only correctly, if no safepoint
   // can happen
   NoSafepointVerifier nsv;
+  LogTarget(Debug, dependencies) lt;
+  const Ticks start = lt.is_enabled() ? Ticks::now() : Ticks();
+  int contexts = 0;
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     InstanceKlass* d = str.klass();
     d->mark_dependent_nmethods(deopt_scope, changes);
+    contexts++;
+  }
+  if (lt.is_enabled()) {
+    ResourceMark rm;
+    LogStream ls(lt);
+    ls.print_cr("Checked %d dependency contexts for %s in " UINT64_FORMAT " us",
+                contexts, changes.type()->external_name(),
+                (Ticks::now() - start).microseconds());
   }
 
 #ifndef PRODUCT
@@ -1795,6 +1810,15 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
                  "disabled (not enough contiguous free space left)",
                  CompileBroker::get_total_compiler_stopped_count(),
                  CompileBroker::get_total_compiler_restarted_count());
+    if (CodeCache_lock->owned_by_self()) {
+      // Fragmentation: free space is only usable in contiguous pieces.
+      // Walking the free lists needs the lock.
+      FOR_ALL_HEAPS(heap_iterator) {
+        CodeHeap* heap = (*heap_iterator);
+        st->print_cr("%s: free_blocks=%d, largest_free=%zuKb",
+                     heap->name(), heap->freelist_length(), heap->largest_free_block()/K);
+      }
+    }
   }
 }
 
@@ -183,7 +183,7 @@ class AbstractCompiler : public CHeapObj<mtCompiler> {
   }
 
   // Print compilation timers and statistics
-  virtual void print_timers() {
+  virtual void print_timers(outputStream* st) {
     ShouldNotReachHere();
   }
 
@@ -28,6 +28,7 @@
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/method.inline.hpp"
 #include "oops/methodData.hpp"
@@ -42,6 +43,8 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ticks.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -149,15 +152,23 @@ void CompilationPolicy::replay_training_at_init_impl(InstanceKlass* klass, TRAPS
       ktd->notice_fully_initialized(); // sets klass->has_init_deps_processed bit
       assert(klass->has_init_deps_processed(), "");
       if (AOTCompileEagerly) {
+        // Collect the recorded compilations whose dependencies are now all
+        // initialized and replay them in the order they happened during training.
+        GrowableArray<CompileTrainingData*> ready;
         ktd->iterate_comp_deps([&](CompileTrainingData* ctd) {
-          if (ctd->init_deps_left() == 0) {
-            MethodTrainingData* mtd = ctd->method();
-            if (mtd->has_holder()) {
-              const methodHandle mh(THREAD, const_cast<Method*>(mtd->holder()));
-              CompilationPolicy::maybe_compile_early(mh, THREAD);
-            }
+          if (ctd->init_deps_left() == 0 && ctd->method()->has_holder()) {
+            ready.append(ctd);
           }
         });
+        ready.sort([](CompileTrainingData** a, CompileTrainingData** b) {
+          return (*a)->compile_id() - (*b)->compile_id();
+        });
+        for (int i = 0; i < ready.length(); i++) {
+          MethodTrainingData* mtd = ready.at(i)->method();
+          const methodHandle mh(THREAD, const_cast<Method*>(mtd->holder()));
+          CompilationPolicy::maybe_compile_early(mh, THREAD);
+        }
+        log_debug(training)("Replay training: %d recorded compilations ready for %s", ready.length(), klass->external_name());
       }
     }
   }
@@ -751,14 +762,19 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
   CompileTask *max_task = nullptr;
   Method* max_method = nullptr;
 
+  const Ticks start = Ticks::now();
   int64_t t = nanos_to_millis(os::javaTimeNanos());
+  int scanned = 0;
+  int removed = 0;
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
     CompileTask* next_task = task->next();
+    scanned++;
     // If a method was unloaded or has been stale for some time, remove it from the queue.
     // Blocking tasks and tasks submitted from whitebox API don't become stale
     if (task->is_unloaded()) {
       compile_queue->remove_and_mark_stale(task);
+      removed++;
       task = next_task;
       continue;
     }
@@ -775,6 +791,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
       }
       method->clear_queued_for_compilation();
       compile_queue->remove_and_mark_stale(task);
+      removed++;
       task = next_task;
       continue;
     }
@@ -794,6 +811,11 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
     task = next_task;
   }
 
+  // The scan runs under MethodCompileQueue_lock; make its cost on big queues visible.
+  log_debug(jit, compilation)("select_task: %s queue: scanned %d tasks, removed %d stale in " UINT64_FORMAT " us",
+                              compile_queue->name(), scanned, removed,
+                              (Ticks::now() - start).microseconds());
+
   if (max_blocking_task != nullptr) {
     // In blocking compilation mode, the CompileBroker will make
     // compilations submitted by a JVMCI compiler thread non-blocking. These
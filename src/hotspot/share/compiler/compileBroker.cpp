@@ -1060,6 +1060,11 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   size_t available_cc_np = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p  = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // Optionally keep C1 and C2 threads together within the CPUs we may use. This is
+  // re-read here, so a changed container CPU quota is picked up. Every compiler
+  // keeps at least one thread.
+  const int cpu_limit = LimitCompilerThreadsToActiveProcessors ? os::active_processor_count() : INT_MAX;
+
   // Only attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
@@ -1069,6 +1074,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / c2_tasks_per_thread,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, MAX2(cpu_limit - old_c1_count, 1));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1130,6 +1136,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / c1_tasks_per_thread,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = MIN2(new_c1_count, MAX2(cpu_limit - (_c2_compile_queue != nullptr ? get_c2_thread_count() : 0), 1));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2660,39 +2667,39 @@ jlong CompileBroker::total_compilation_ticks() {
   return _perf_total_compilation != nullptr ? _perf_total_compilation->get_value() : 0;
 }
 
-void CompileBroker::print_times(const char* name, CompilerStatistics* stats) {
-  tty->print_cr("  %s {speed: %6.3f bytes/s; standard: %6.3f s, %u bytes, %u methods; osr: %6.3f s, %u bytes, %u methods; nmethods_size: %u bytes; nmethods_code_size: %u bytes}",
+void CompileBroker::print_times(outputStream* st, const char* name, CompilerStatistics* stats) {
+  st->print_cr("  %s {speed: %6.3f bytes/s; standard: %6.3f s, %u bytes, %u methods; osr: %6.3f s, %u bytes, %u methods; nmethods_size: %u bytes; nmethods_code_size: %u bytes}",
                 name, stats->bytes_per_second(),
                 stats->_standard._time.seconds(), stats->_standard._bytes, stats->_standard._count,
                 stats->_osr._time.seconds(), stats->_osr._bytes, stats->_osr._count,
                 stats->_nmethods_size, stats->_nmethods_code_size);
 }
 
-void CompileBroker::print_times(bool per_compiler, bool aggregate) {
+void CompileBroker::print_times(outputStream* st, bool per_compiler, bool aggregate) {
   if (per_compiler) {
     if (aggregate) {
-      tty->cr();
-      tty->print_cr("Individual compiler times (for compiled methods only)");
-      tty->print_cr("------------------------------------------------");
-      tty->cr();
+      st->cr();
+      st->print_cr("Individual compiler times (for compiled methods only)");
+      st->print_cr("------------------------------------------------");
+      st->cr();
     }
     for (unsigned int i = 0; i < sizeof(_compilers) / sizeof(AbstractCompiler*); i++) {
       AbstractCompiler* comp = _compilers[i];
       if (comp != nullptr) {
-        print_times(comp->name(), comp->stats());
+        print_times(st, comp->name(), comp->stats());
       }
     }
     if (aggregate) {
-      tty->cr();
-      tty->print_cr("Individual compilation Tier times (for compiled methods only)");
-      tty->print_cr("------------------------------------------------");
-      tty->cr();
+      st->cr();
+      st->print_cr("Individual compilation Tier times (for compiled methods only)");
+      st->print_cr("------------------------------------------------");
+      st->cr();
     }
     char tier_name[256];
     for (int tier = CompLevel_simple; tier <= CompilationPolicy::highest_compile_level(); tier++) {
       CompilerStatistics* stats = &_stats_per_level[tier-1];
       os::snprintf_checked(tier_name, sizeof(tier_name), "Tier%d", tier);
-      print_times(tier_name, stats);
+      print_times(st, tier_name, stats);
     }
   }
 
@@ -2716,59 +2723,59 @@ void CompileBroker::print_times(bool per_compiler, bool aggregate) {
   uint nmethods_code_size = CompileBroker::_sum_nmethod_code_size;
   uint nmethods_size = CompileBroker::_sum_nmethod_size;
 
-  tty->cr();
-  tty->print_cr("Accumulated compiler times");
-  tty->print_cr("----------------------------------------------------------");
+  st->cr();
+  st->print_cr("Accumulated compiler times");
+  st->print_cr("----------------------------------------------------------");
                //0000000000111111111122222222223333333333444444444455555555556666666666
                //0123456789012345678901234567890123456789012345678901234567890123456789
-  tty->print_cr("  Total compilation time   : %7.3f s", total_compilation.seconds());
-  tty->print_cr("    Standard compilation   : %7.3f s, Average : %2.3f s",
+  st->print_cr("  Total compilation time   : %7.3f s", total_compilation.seconds());
+  st->print_cr("    Standard compilation   : %7.3f s, Average : %2.3f s",
                 standard_compilation.seconds(),
                 standard_compile_count == 0 ? 0.0 : standard_compilation.seconds() / standard_compile_count);
-  tty->print_cr("    Bailed out compilation : %7.3f s, Average : %2.3f s",
+  st->print_cr("    Bailed out compilation : %7.3f s, Average : %2.3f s",
                 CompileBroker::_t_bailedout_compilation.seconds(),
                 total_bailout_count == 0 ? 0.0 : CompileBroker::_t_bailedout_compilation.seconds() / total_bailout_count);
-  tty->print_cr("    On stack replacement   : %7.3f s, Average : %2.3f s",
+  st->print_cr("    On stack replacement   : %7.3f s, Average : %2.3f s",
                 osr_compilation.seconds(),
                 osr_compile_count == 0 ? 0.0 : osr_compilation.seconds() / osr_compile_count);
-  tty->print_cr("    Invalidated            : %7.3f s, Average : %2.3f s",
+  st->print_cr("    Invalidated            : %7.3f s, Average : %2.3f s",
                 CompileBroker::_t_invalidated_compilation.seconds(),
                 total_invalidated_count == 0 ? 0.0 : CompileBroker::_t_invalidated_compilation.seconds() / total_invalidated_count);
 
   AbstractCompiler *comp = compiler(CompLevel_simple);
   if (comp != nullptr) {
-    tty->cr();
-    comp->print_timers();
+    st->cr();
+    comp->print_timers(st);
   }
   comp = compiler(CompLevel_full_optimization);
   if (comp != nullptr) {
-    tty->cr();
-    comp->print_timers();
+    st->cr();
+    comp->print_timers(st);
   }
 #if INCLUDE_JVMCI
   if (EnableJVMCI) {
     JVMCICompiler *jvmci_comp = JVMCICompiler::instance(false, JavaThread::current_or_null());
     if (jvmci_comp != nullptr && jvmci_comp != comp) {
-      tty->cr();
-      jvmci_comp->print_timers();
+      st->cr();
+      jvmci_comp->print_timers(st);
     }
   }
 #endif
 
-  tty->cr();
-  tty->print_cr("  Total compiled methods    : %8u methods", total_compile_count);
-  tty->print_cr("    Standard compilation    : %8u methods", standard_compile_count);
-  tty->print_cr("    On stack replacement    : %8u methods", osr_compile_count);
+  st->cr();
+  st->print_cr("  Total compiled methods    : %8u methods", total_compile_count);
+  st->print_cr("    Standard compilation    : %8u methods", standard_compile_count);
+  st->print_cr("    On stack replacement    : %8u methods", osr_compile_count);
   uint tcb = osr_bytes_compiled + standard_bytes_compiled;
-  tty->print_cr("  Total compiled bytecodes  : %8u bytes", tcb);
-  tty->print_cr("    Standard compilation    : %8u bytes", standard_bytes_compiled);
-  tty->print_cr("    On stack replacement    : %8u bytes", osr_bytes_compiled);
+  st->print_cr("  Total compiled bytecodes  : %8u bytes", tcb);
+  st->print_cr("    Standard compilation    : %8u bytes", standard_bytes_compiled);
+  st->print_cr("    On stack replacement    : %8u bytes", osr_bytes_compiled);
   double tcs = total_compilation.seconds();
   uint bps = tcs == 0.0 ? 0 : (uint)(tcb / tcs);
-  tty->print_cr("  Average compilation speed : %8u bytes/s", bps);
-  tty->cr();
-  tty->print_cr("  nmethod code size         : %8u bytes", nmethods_code_size);
-  tty->print_cr("  nmethod total size        : %8u bytes", nmethods_size);
+  st->print_cr("  Average compilation speed : %8u bytes/s", bps);
+  st->cr();
+  st->print_cr("  nmethod code size         : %8u bytes", nmethods_code_size);
+  st->print_cr("  nmethod total size        : %8u bytes", nmethods_size);
 }
 
 // Print general/accumulated JIT information.
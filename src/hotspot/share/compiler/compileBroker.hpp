@@ -399,10 +399,10 @@ class CompileBroker: AllStatic {
   static void mark_on_stack();
 
   // Print current compilation time stats for a given compiler
-  static void print_times(const char* name, CompilerStatistics* stats);
+  static void print_times(outputStream* st, const char* name, CompilerStatistics* stats);
 
   // Print a detailed accounting of compilation time
-  static void print_times(bool per_compiler = true, bool aggregate = true);
+  static void print_times(outputStream* st, bool per_compiler = true, bool aggregate = true);
 
   // compiler name for debugging
   static const char* compiler_name(int comp_level);
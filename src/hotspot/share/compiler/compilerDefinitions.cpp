@@ -399,6 +399,20 @@ void CompilerConfig::set_compilation_policy_flags() {
     FLAG_SET_ERGO(Tier4BackEdgeThreshold, jvmflag_scaled_compile_threshold(Tier4BackEdgeThreshold));
   }
 
+#ifndef X86
+  // Sampled profile updates (MacroAssembler::profile_sample) are x86 only.
+  if (InterpreterProfileSampleRate > 1) {
+    warning("InterpreterProfileSampleRate is not supported on this platform");
+    FLAG_SET_DEFAULT(InterpreterProfileSampleRate, 1);
+  }
+#ifdef COMPILER1
+  if (C1ProfileCallSampleRate > 1) {
+    warning("C1ProfileCallSampleRate is not supported on this platform");
+    FLAG_SET_DEFAULT(C1ProfileCallSampleRate, 1);
+  }
+#endif
+#endif
+
 #ifdef COMPILER1
   // Reduce stack usage due to inlining of methods which require much stack.
   // (High tier compiler can inline better based on profiling information.)
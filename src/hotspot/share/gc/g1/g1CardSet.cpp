@@ -180,6 +180,27 @@ uint G1CardSetConfiguration::max_cards_in_inline_ptr(uint bits_per_card) {
   return G1CardSetInlinePtr::max_cards_in_inline_ptr(bits_per_card);
 }
 
+double G1CardSetConfiguration::cards_in_howl_bitmap_threshold_percent() const {
+  return (double)cards_in_howl_bitmap_threshold() / _max_cards_in_howl_bitmap;
+}
+
+double G1CardSetConfiguration::cards_in_howl_threshold_percent() const {
+  return (double)cards_in_howl_threshold() / _max_cards_in_card_set;
+}
+
+void G1CardSetConfiguration::set_coarsen_thresholds_percent(double cards_in_bitmap_threshold_percent,
+                                                            double cards_in_howl_threshold_percent) {
+  assert(cards_in_bitmap_threshold_percent >= 0.0 && cards_in_bitmap_threshold_percent <= 1.0,
+         "cards_in_bitmap_threshold_percent (%1.2f) out of range", cards_in_bitmap_threshold_percent);
+  assert(cards_in_howl_threshold_percent >= 0.0 && cards_in_howl_threshold_percent <= 1.0,
+         "cards_in_howl_threshold_percent (%1.2f) out of range", cards_in_howl_threshold_percent);
+
+  // Concurrent refinement threads may observe either the old or the new
+  // value; both are valid thresholds.
+  Atomic::store(&_cards_in_howl_bitmap_threshold, (uint)(_max_cards_in_howl_bitmap * cards_in_bitmap_threshold_percent));
+  Atomic::store(&_cards_in_howl_threshold, (uint)(_max_cards_in_card_set * cards_in_howl_threshold_percent));
+}
+
 const G1CardSetAllocOptions* G1CardSetConfiguration::mem_object_alloc_options(uint idx) {
   return &_card_set_alloc_options[idx];
 }
@@ -221,6 +242,11 @@ void G1CardSetCoarsenStats::record_coarsening(uint tag, bool collision) {
   }
 }
 
+size_t G1CardSetCoarsenStats::num_coarsenings_to_full() const {
+  // Howl->Full and (Howl) BitMap->Full, see print_on().
+  return _coarsen_from[3] + _coarsen_from[6];
+}
+
 void G1CardSetCoarsenStats::print_on(outputStream* out) {
   out->print_cr("Inline->AoC %zu (%zu) "
                 "AoC->Howl %zu (%zu) "
@@ -391,6 +417,7 @@ void G1CardSetHashTableConfig::free_node(void* context, void* memory, Value cons
 
 G1CardSetCoarsenStats G1CardSet::_coarsen_stats;
 G1CardSetCoarsenStats G1CardSet::_last_coarsen_stats;
+G1CardSetCoarsenStats G1CardSet::_last_adjust_coarsen_stats;
 
 G1CardSet::G1CardSet(G1CardSetConfiguration* config, G1CardSetMemoryManager* mm) :
   _mm(mm),
@@ -1039,6 +1066,51 @@ void G1CardSet::print_coarsen_stats(outputStream* out) {
   _last_coarsen_stats.set(_coarsen_stats);
 }
 
+void G1CardSet::adjust_coarsen_thresholds(G1CardSetConfiguration* config,
+                                          size_t card_set_mem_size,
+                                          size_t heap_capacity) {
+  // Bounds and step size of the coarsening thresholds, relative to the size of
+  // the container.
+  const double MinThresholdPercent = 0.5;
+  const double MaxThresholdPercent = 1.0;
+  const double ThresholdStepPercent = 0.05;
+
+  G1CardSetCoarsenStats recent = _last_adjust_coarsen_stats;
+  recent.subtract_from(_coarsen_stats);
+  _last_adjust_coarsen_stats.set(_coarsen_stats);
+
+  double bitmap_percent = config->cards_in_howl_bitmap_threshold_percent();
+  double howl_percent = config->cards_in_howl_threshold_percent();
+
+  size_t const mem_budget = heap_capacity / 100 * G1RemSetAdaptiveCoarseningMemoryPercent;
+  size_t const num_to_full = recent.num_coarsenings_to_full();
+
+  double step;
+  if (card_set_mem_size > mem_budget) {
+    // Coarsening to Full frees the memory of the Howl and BitMap containers.
+    step = -ThresholdStepPercent;
+  } else if (num_to_full > 0) {
+    // Memory is available, so keep more precise containers around.
+    step = ThresholdStepPercent;
+  } else {
+    return;
+  }
+
+  double new_bitmap_percent = clamp(bitmap_percent + step, MinThresholdPercent, MaxThresholdPercent);
+  double new_howl_percent = clamp(howl_percent + step, MinThresholdPercent, MaxThresholdPercent);
+
+  config->set_coarsen_thresholds_percent(new_bitmap_percent, new_howl_percent);
+
+  log_debug(gc, remset)("Adjust coarsening thresholds: memory %zu%s budget %zu%s "
+                        "coarsenings to full %zu "
+                        "BitMap->Full %1.2f -> %1.2f Howl->Full %1.2f -> %1.2f",
+                        byte_size_in_proper_unit(card_set_mem_size), proper_unit_for_byte_size(card_set_mem_size),
+                        byte_size_in_proper_unit(mem_budget), proper_unit_for_byte_size(mem_budget),
+                        num_to_full,
+                        bitmap_percent, new_bitmap_percent,
+                        howl_percent, new_howl_percent);
+}
+
 size_t G1CardSet::mem_size() const {
   return sizeof(*this) +
          _table->mem_size() +
@@ -27,6 +27,7 @@
 
 #include "memory/allocation.hpp"
 #include "memory/memRegion.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/concurrentHashTable.hpp"
 
 class G1CardSetAllocOptions;
@@ -99,17 +100,25 @@ class G1CardSetConfiguration {
   // Bitmap within Howl card set container configuration
   uint max_cards_in_howl_bitmap() const { return _max_cards_in_howl_bitmap; }
   // (Approximate) Number of cards in bitmap to coarsen Howl Bitmap to Howl Full.
-  uint cards_in_howl_bitmap_threshold() const { return _cards_in_howl_bitmap_threshold; }
+  uint cards_in_howl_bitmap_threshold() const { return Atomic::load(&_cards_in_howl_bitmap_threshold); }
   uint log2_max_cards_in_howl_bitmap() const {return _log2_max_cards_in_howl_bitmap;}
 
   // Howl card set container configuration
   uint num_buckets_in_howl() const { return _num_buckets_in_howl; }
   // Threshold at which to turn howling arrays into Full.
-  uint cards_in_howl_threshold() const { return _cards_in_howl_threshold; }
+  uint cards_in_howl_threshold() const { return Atomic::load(&_cards_in_howl_threshold); }
   uint howl_bitmap_offset(uint card_idx) const { return card_idx & _bitmap_hash_mask; }
   // Given a card index, return the bucket in the array of card sets.
   uint howl_bucket_index(uint card_idx) { return card_idx >> _log2_max_cards_in_howl_bitmap; }
 
+  // Change the coarsening thresholds above relative to the maximum number of
+  // cards of the respective containers. Only affects subsequent coarsenings;
+  // the size of existing and new containers does not change.
+  double cards_in_howl_bitmap_threshold_percent() const;
+  double cards_in_howl_threshold_percent() const;
+  void set_coarsen_thresholds_percent(double cards_in_bitmap_threshold_percent,
+                                      double cards_in_howl_threshold_percent);
+
   // Full card configuration
   // Maximum number of cards in a non-full card set for a single card region. Card sets
   // with more entries per region are coarsened to Full.
@@ -170,6 +179,10 @@ class G1CardSetCoarsenStats {
   // this coarsening lost the race to do the coarsening of that category.
   void record_coarsening(uint tag, bool collision);
 
+  // Number of coarsenings that resulted in a Full container, i.e. from Howl or
+  // from a BitMap in a Howl container.
+  size_t num_coarsenings_to_full() const;
+
   void print_on(outputStream* out);
 };
 
@@ -201,6 +214,7 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
 
   static G1CardSetCoarsenStats _coarsen_stats; // Coarsening statistics since VM start.
   static G1CardSetCoarsenStats _last_coarsen_stats; // Coarsening statistics before last GC.
+  static G1CardSetCoarsenStats _last_adjust_coarsen_stats; // Coarsening statistics at last threshold adjustment.
 public:
   // Two lower bits are used to encode the card set container types
   static const uintptr_t ContainerPtrHeaderSize = 2;
@@ -369,6 +383,14 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   static G1CardSetCoarsenStats coarsen_stats();
   static void print_coarsen_stats(outputStream* out);
 
+  // Adapt the coarsening thresholds of the given configuration: coarsen
+  // earlier if the given remembered set memory usage exceeds the
+  // G1RemSetAdaptiveCoarseningMemoryPercent of heap capacity, and later if
+  // there were coarsenings to Full since the last adjustment.
+  static void adjust_coarsen_thresholds(G1CardSetConfiguration* config,
+                                        size_t card_set_mem_size,
+                                        size_t heap_capacity);
+
   // Returns size of the actual remembered set containers in bytes.
   size_t mem_size() const;
   size_t unused_mem_size() const;
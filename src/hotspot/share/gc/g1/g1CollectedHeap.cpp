@@ -31,6 +31,7 @@
 #include "gc/g1/g1Arguments.hpp"
 #include "gc/g1/g1BarrierSet.hpp"
 #include "gc/g1/g1BatchedTask.hpp"
+#include "gc/g1/g1CardSet.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1CollectionSetCandidates.hpp"
@@ -109,6 +110,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vmThread.hpp"
@@ -366,6 +368,7 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
       policy()->record_new_heap_size(num_committed_regions());
     } else {
       // Policy: Potentially trigger a defragmentation GC.
+      policy()->record_humongous_allocation_fragmented(word_size);
     }
   }
 
@@ -1192,6 +1195,8 @@ G1CollectedHeap::G1CollectedHeap() :
   _monitoring_support(nullptr),
   _num_humongous_objects(0),
   _num_humongous_reclaim_candidates(0),
+  _pending_class_unloading_purge(nullptr),
+  _class_unloading_purge_in_progress(false),
   _collector_state(),
   _old_marking_cycles_started(0),
   _old_marking_cycles_completed(0),
@@ -2281,6 +2286,12 @@ void G1CollectedHeap::gc_epilogue(bool full) {
   _free_arena_memory_task->notify_new_stats(&_young_gen_card_set_stats,
                                             &_collection_set_candidates_card_set_stats);
 
+  if (!full && G1RemSetAdaptiveCoarsening) {
+    G1CardSet::adjust_coarsen_thresholds(&_card_set_config,
+                                         _collection_set_candidates_card_set_stats.mem_size(),
+                                         capacity());
+  }
+
   update_perf_counter_cpu_time();
 }
 
@@ -2544,35 +2555,112 @@ void G1CollectedHeap::complete_cleaning(bool class_unloading_occurred) {
   workers()->run_task(&unlink_task);
 }
 
-void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjectClosure* is_alive, GCTimer* timer) {
+void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjectClosure* is_alive, GCTimer* timer,
+                                              bool allow_concurrent_purge) {
   GCTraceTime(Debug, gc, phases) debug(description, timer);
 
-  ClassUnloadingContext ctx(workers()->active_workers(),
-                            false /* unregister_nmethods_during_purge */,
-                            false /* lock_nmethod_free_separately */);
+  complete_pending_class_unloading_purge(timer);
+
+  bool const concurrent_purge = allow_concurrent_purge && G1ConcurrentClassUnloadingPurge;
+  // Freeing nmethods concurrently must not block the compiler threads for the
+  // whole operation.
+  ClassUnloadingContext* ctx = new ClassUnloadingContext(workers()->active_workers(),
+                                                         false /* unregister_nmethods_during_purge */,
+                                                         concurrent_purge /* lock_nmethod_free_separately */);
   {
     CodeCache::UnlinkingScope scope(is_alive);
     bool unloading_occurred = SystemDictionary::do_unloading(timer);
     GCTraceTime(Debug, gc, phases) t("G1 Complete Cleaning", timer);
     complete_cleaning(unloading_occurred);
+    if (unloading_occurred) {
+      // The per type survival statistics may refer to unloaded classes.
+      policy()->clear_pretenure_table();
+    }
   }
   {
     GCTraceTime(Debug, gc, phases) t("Purge Unlinked NMethods", timer);
-    ctx.purge_nmethods();
+    ctx->purge_nmethods();
   }
   {
     GCTraceTime(Debug, gc, phases) ur("Unregister NMethods", timer);
     G1CollectedHeap::heap()->bulk_unregister_nmethods();
   }
+
+  if (concurrent_purge) {
+    // The unlinked nmethods are not registered with any region any more and
+    // the unloaded class loader data is not reachable through the class loader
+    // data graph, so they can be freed concurrently.
+    ctx->uninstall();
+    _pending_class_unloading_purge = ctx;
+  } else {
+    purge_class_unloading(ctx, true /* at_safepoint */, timer);
+  }
+}
+
+void G1CollectedHeap::purge_class_unloading(ClassUnloadingContext* ctx, bool at_safepoint, GCTimer* timer) {
   {
     GCTraceTime(Debug, gc, phases) t("Free Code Blobs", timer);
-    ctx.free_nmethods();
+    ctx->free_nmethods();
   }
   {
     GCTraceTime(Debug, gc, phases) t("Purge Class Loader Data", timer);
-    ClassLoaderDataGraph::purge(true /* at_safepoint */);
+    ClassLoaderDataGraph::purge(ctx, at_safepoint);
     DEBUG_ONLY(MetaspaceUtils::verify();)
   }
+  delete ctx;
+}
+
+void G1CollectedHeap::complete_pending_class_unloading_purge(GCTimer* timer) {
+  assert_at_safepoint_on_vm_thread();
+  {
+    // The class loader data graph must not be purged concurrently.
+    MonitorLocker ml(G1ClassUnloadingPurge_lock, Mutex::_no_safepoint_check_flag);
+    while (_class_unloading_purge_in_progress) {
+      ml.wait();
+    }
+  }
+  if (_pending_class_unloading_purge != nullptr) {
+    GCTraceTime(Debug, gc, phases) t("Complete Pending Class Unloading Purge", timer);
+    purge_class_unloading(_pending_class_unloading_purge, true /* at_safepoint */, timer);
+    _pending_class_unloading_purge = nullptr;
+  }
+}
+
+void G1CollectedHeap::purge_class_unloading_concurrently() {
+  assert(Thread::current()->is_ConcurrentGC_thread(), "must be");
+  // Number of nmethods to free between checks for a pending safepoint.
+  const int NMethodsPerYield = 64;
+
+  ClassUnloadingContext* ctx;
+  {
+    // Free the nmethods in batches, yielding to safepoints in between. A
+    // safepoint that unloads classes completes the whole purge itself, so
+    // reload the context after every yield.
+    SuspendibleThreadSetJoiner sts;
+    while (true) {
+      ctx = _pending_class_unloading_purge;
+      if (ctx == nullptr) {
+        return;
+      }
+      if (ctx->free_nmethods(NMethodsPerYield)) {
+        break;
+      }
+      sts.yield();
+    }
+    // Take over the context while still joined, so that safepoints see either
+    // the pending purge or the purge in progress.
+    MutexLocker ml(G1ClassUnloadingPurge_lock, Mutex::_no_safepoint_check_flag);
+    _pending_class_unloading_purge = nullptr;
+    _class_unloading_purge_in_progress = true;
+  }
+
+  // Purging the class loader data does not need to block safepoints.
+  ClassLoaderDataGraph::purge(ctx, false /* at_safepoint */);
+  delete ctx;
+
+  MonitorLocker ml(G1ClassUnloadingPurge_lock, Mutex::_no_safepoint_check_flag);
+  _class_unloading_purge_in_progress = false;
+  ml.notify_all();
 }
 
 class G1BulkUnregisterNMethodTask : public WorkerTask {
@@ -2652,6 +2740,10 @@ void G1CollectedHeap::record_obj_copy_mem_stats() {
   policy()->old_gen_alloc_tracker()->
     add_allocated_bytes_since_last_gc(total_old_allocated * HeapWordSize);
 
+  size_t total_copied = _survivor_evac_stats.used() + _survivor_evac_stats.direct_allocated() +
+                        _old_evac_stats.used() + _old_evac_stats.direct_allocated();
+  policy()->record_evacuation_region_usage(total_allocated, total_copied * HeapWordSize);
+
   _gc_tracer_stw->report_evacuation_statistics(create_g1_evac_summary(&_survivor_evac_stats),
                                                create_g1_evac_summary(&_old_evac_stats));
 }
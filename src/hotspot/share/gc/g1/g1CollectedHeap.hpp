@@ -65,6 +65,7 @@
 // heap subsets that will yield large amounts of garbage.
 
 // Forward declarations
+class ClassUnloadingContext;
 class G1Allocator;
 class G1BatchedTask;
 class G1CardTableEntryClosure;
@@ -251,6 +252,23 @@ class G1CollectedHeap : public CollectedHeap {
 
   uint _num_humongous_objects; // Current amount of (all) humongous objects found in the heap.
   uint _num_humongous_reclaim_candidates; // Number of humongous object eager reclaim candidates.
+
+  // Class unloading context of the last Remark pause whose unlinked nmethods
+  // and class loader data still need to be freed concurrently, if any. The
+  // context is not installed as the current context any more. Only changed
+  // at a safepoint or by the concurrent mark thread while joined to the
+  // suspendible thread set.
+  ClassUnloadingContext* _pending_class_unloading_purge;
+  // Whether the concurrent mark thread is purging class loader data outside
+  // of the suspendible thread set. Protected by G1ClassUnloadingPurge_lock.
+  bool _class_unloading_purge_in_progress;
+
+  // Free the unlinked nmethods and class loader data of the given context and
+  // delete it.
+  void purge_class_unloading(ClassUnloadingContext* ctx, bool at_safepoint, GCTimer* timer);
+  // Complete any class unloading purge deferred by the last Remark pause at a
+  // safepoint, waiting for the concurrent part still in progress.
+  void complete_pending_class_unloading_purge(GCTimer* timer);
 public:
   uint num_humongous_objects() const { return _num_humongous_objects; }
   uint num_humongous_reclaim_candidates() const { return _num_humongous_reclaim_candidates; }
@@ -567,6 +585,8 @@ class G1CollectedHeap : public CollectedHeap {
   void uncommit_regions_if_necessary();
   // Immediately uncommit uncommittable regions.
   uint uncommit_regions(uint region_limit);
+  // The page size used to commit and uncommit the Java heap.
+  size_t heap_page_size() const { return _hrm.heap_page_size(); }
   bool has_uncommittable_regions();
 
   G1NUMA* numa() const { return _numa; }
@@ -1273,7 +1293,16 @@ class G1CollectedHeap : public CollectedHeap {
   // Performs cleaning of data structures after class unloading.
   void complete_cleaning(bool class_unloading_occurred);
 
-  void unload_classes_and_code(const char* description, BoolObjectClosure* cl, GCTimer* timer);
+  // Unload classes and code not considered live by the given closure. If
+  // allow_concurrent_purge is set, freeing the unlinked nmethods and class loader
+  // data may be deferred to purge_class_unloading_concurrently().
+  void unload_classes_and_code(const char* description, BoolObjectClosure* cl, GCTimer* timer,
+                               bool allow_concurrent_purge = false);
+
+  bool has_pending_class_unloading_purge() const { return _pending_class_unloading_purge != nullptr; }
+  // Complete a class unloading purge deferred by the last Remark pause.
+  // Called by the concurrent mark thread.
+  void purge_class_unloading_concurrently();
 
   void bulk_unregister_nmethods();
 
@@ -312,6 +312,7 @@ double G1CollectionSet::finalize_young_part(double target_pause_time_ms, G1Survi
   double predicted_eden_time = _policy->predict_young_region_other_time_ms(eden_region_length) +
                                _policy->predict_eden_copy_time_ms(eden_region_length);
   double remaining_time_ms = MAX2(target_pause_time_ms - (predicted_base_time_ms + predicted_eden_time), 0.0);
+  _policy->record_predicted_pause_time_ms(predicted_base_time_ms + predicted_eden_time);
 
   log_trace(gc, ergo, cset)("Added young regions to CSet. Eden: %u regions, Survivors: %u regions, "
                             "predicted eden time: %1.2fms, predicted base time: %1.2fms, target pause time: %1.2fms, remaining time: %1.2fms",
@@ -477,6 +478,7 @@ double G1CollectionSet::select_candidates_from_marking(double time_remaining_ms)
                             "predicted initial time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2fms",
                             selected_groups.num_regions(), selected_groups.length(), _optional_groups.num_regions(), _optional_groups.length(),
                             predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms);
+  _policy->add_predicted_pause_time_ms(predicted_initial_time_ms);
 
   assert(selected_groups.num_regions() == num_inital_regions, "must be");
   assert(_optional_groups.num_regions() == num_optional_regions, "must be");
@@ -587,6 +589,7 @@ void G1CollectionSet::select_candidates_from_retained(double time_remaining_ms)
                             "time remaining: %1.2fms optional time remaining %1.2fms",
                             num_initial_regions, selected_optional_regions, num_pinned_regions,
                             predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms, optional_time_remaining_ms);
+  _policy->add_predicted_pause_time_ms(predicted_initial_time_ms);
 }
 
 double G1CollectionSet::select_candidates_from_optional_groups(double time_remaining_ms, uint& num_regions_selected) {
@@ -635,6 +638,7 @@ uint G1CollectionSet::select_optional_collection_set_regions(double time_remaini
   double total_prediction_ms = select_candidates_from_optional_groups(time_remaining_ms, num_regions_selected);
 
   time_remaining_ms -= total_prediction_ms;
+  _policy->add_predicted_pause_time_ms(total_prediction_ms);
 
   log_debug(gc, ergo, cset)("Prepared %u regions out of %u for optional evacuation. Total predicted time: %.3fms",
                             num_regions_selected, optional_regions_count, total_prediction_ms);
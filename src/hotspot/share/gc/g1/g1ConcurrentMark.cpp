@@ -1400,7 +1400,7 @@ void G1ConcurrentMark::remark() {
     // Unload Klasses, String, Code Cache, etc.
     if (ClassUnloadingWithConcurrentMark) {
       G1CMIsAliveClosure is_alive(this);
-      _g1h->unload_classes_and_code("Class Unloading", &is_alive, _gc_timer_cm);
+      _g1h->unload_classes_and_code("Class Unloading", &is_alive, _gc_timer_cm, true /* allow_concurrent_purge */);
     }
 
     SATBMarkQueueSet& satb_mq_set = G1BarrierSet::satb_mark_queue_set();
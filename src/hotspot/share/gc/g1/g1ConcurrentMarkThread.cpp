@@ -231,6 +231,14 @@ bool G1ConcurrentMarkThread::subphase_remark() {
   return _cm->has_aborted();
 }
 
+bool G1ConcurrentMarkThread::phase_purge_class_unloading() {
+  if (G1CollectedHeap::heap()->has_pending_class_unloading_purge()) {
+    G1ConcPhaseTimer p(_cm, "Concurrent Purge Unloaded Classes and Code");
+    G1CollectedHeap::heap()->purge_class_unloading_concurrently();
+  }
+  return _cm->has_aborted();
+}
+
 bool G1ConcurrentMarkThread::phase_rebuild_and_scrub() {
   ConcurrentGCBreakpoints::at("AFTER REBUILD STARTED");
   G1ConcPhaseTimer p(_cm, "Concurrent Rebuild Remembered Sets and Scrub Regions");
@@ -289,19 +297,22 @@ void G1ConcurrentMarkThread::concurrent_mark_cycle_do() {
   // Phase 2: Actual mark loop.
   if (phase_mark_loop()) return;
 
-  // Phase 3: Rebuild remembered sets and scrub dead objects.
+  // Phase 3: Purge classes and code unloaded during Remark.
+  if (phase_purge_class_unloading()) return;
+
+  // Phase 4: Rebuild remembered sets and scrub dead objects.
   if (phase_rebuild_and_scrub()) return;
 
-  // Phase 4: Wait for Cleanup.
+  // Phase 5: Wait for Cleanup.
   if (phase_delay_to_keep_mmu_before_cleanup()) return;
 
-  // Phase 5: Cleanup pause
+  // Phase 6: Cleanup pause
   if (phase_cleanup()) return;
 
-  // Phase 6: Clear CLD claimed marks.
+  // Phase 7: Clear CLD claimed marks.
   if (phase_clear_cld_claimed_marks()) return;
 
-  // Phase 7: Clear bitmap for next mark.
+  // Phase 8: Clear bitmap for next mark.
   phase_clear_bitmap_for_next_mark();
 }
 
@@ -62,6 +62,8 @@ class G1ConcurrentMarkThread: public ConcurrentGCThread {
   bool subphase_delay_to_keep_mmu_before_remark();
   bool subphase_remark();
 
+  bool phase_purge_class_unloading();
+
   bool phase_rebuild_and_scrub();
   bool phase_delay_to_keep_mmu_before_cleanup();
   bool phase_cleanup();
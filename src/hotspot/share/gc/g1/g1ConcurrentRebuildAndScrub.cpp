@@ -28,12 +28,14 @@
 #include "gc/g1/g1ConcurrentRebuildAndScrub.hpp"
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/g1/g1HeapRegionManager.inline.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -74,6 +76,8 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
     const bool _should_rebuild_remset;
 
     size_t _processed_words;
+    // Thread CPU time at the start of the current time slice.
+    jlong _slice_start_cpu_time_ns;
 
     const size_t ProcessingYieldLimitInWords = G1RebuildRemSetChunkSize / HeapWordSize;
 
@@ -91,15 +95,40 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
     bool yield_if_necessary(G1HeapRegion* hr) {
       if (_processed_words >= ProcessingYieldLimitInWords) {
         reset_processed_words();
+        bool throttled = throttle_if_necessary();
         // If a yield occurs (potential young-gc pause), must recheck for
         // potential regions reclamation.
-        if (_cm->do_yield_check() && !should_rebuild_or_scrub(hr)) {
+        if ((_cm->do_yield_check() || throttled) && !should_rebuild_or_scrub(hr)) {
           return true;
         }
       }
       return _cm->has_aborted() || !should_rebuild_or_scrub(hr);
     }
 
+    // Pause the current worker if it used up the CPU time allowed for the
+    // current time slice as given by the policy's duty cycle. Returns whether
+    // the worker paused; a garbage collection may have occurred meanwhile.
+    bool throttle_if_necessary() {
+      double const duty_cycle = G1CollectedHeap::heap()->policy()->concurrent_rebuild_duty_cycle();
+      if (duty_cycle >= 1.0) {
+        return false;
+      }
+
+      double const slice_ms = (double)(os::current_thread_cpu_time() - _slice_start_cpu_time_ns) / NANOSECS_PER_MILLISEC;
+      if (slice_ms < G1RebuildRemSetSliceMillis) {
+        return false;
+      }
+
+      jlong const pause_ms = (jlong)(slice_ms * (1.0 - duty_cycle) / duty_cycle);
+      if (pause_ms > 0) {
+        // Do not block safepoints while pausing.
+        SuspendibleThreadSetLeaver sts_leave;
+        os::naked_sleep(pause_ms);
+      }
+      _slice_start_cpu_time_ns = os::current_thread_cpu_time();
+      return pause_ms > 0;
+    }
+
     // Returns whether the top at rebuild start value for the given region indicates
     // that there is some rebuild or scrubbing work.
     //
@@ -247,7 +276,8 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       _bitmap(_cm->mark_bitmap()),
       _rebuild_closure(G1CollectedHeap::heap(), worker_id),
       _should_rebuild_remset(should_rebuild_remset),
-      _processed_words(0) { }
+      _processed_words(0),
+      _slice_start_cpu_time_ns(os::current_thread_cpu_time()) { }
 
     bool do_heap_region(G1HeapRegion* hr) {
       // Avoid stalling safepoints and stop iteration if mark cycle has been aborted.
@@ -93,6 +93,7 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _gc_par_phases[Termination] = new WorkerDataArray<double>("Termination", "Termination (ms):", max_gc_threads);
   _gc_par_phases[OptTermination] = new WorkerDataArray<double>("OptTermination", "Optional Termination (ms):", max_gc_threads);
   _gc_par_phases[GCWorkerTotal] = new WorkerDataArray<double>("GCWorkerTotal", "GC Worker Total (ms):", max_gc_threads);
+  _gc_par_phases[GCWorkerCPUTime] = new WorkerDataArray<double>("GCWorkerCPUTime", "GC Worker CPU Time (ms):", max_gc_threads);
   _gc_par_phases[GCWorkerEnd] = new WorkerDataArray<double>("GCWorkerEnd", "GC Worker End (ms):", max_gc_threads);
   _gc_par_phases[Other] = new WorkerDataArray<double>("Other", "GC Worker Other (ms):", max_gc_threads);
   _gc_par_phases[MergePSS] = new WorkerDataArray<double>("MergePSS", "Merge Per-Thread State (ms):", max_gc_threads);
@@ -245,6 +246,7 @@ void G1GCPhaseTimes::record_gc_pause_end() {
     } else {
       // Make sure all slots are uninitialized since this thread did not seem to have been started
       ASSERT_PHASE_UNINITIALIZED(GCWorkerEnd);
+      ASSERT_PHASE_UNINITIALIZED(GCWorkerCPUTime);
       ASSERT_PHASE_UNINITIALIZED(ExtRootScan);
       ASSERT_PHASE_UNINITIALIZED(MergeER);
       ASSERT_PHASE_UNINITIALIZED(MergeRS);
@@ -474,6 +476,7 @@ double G1GCPhaseTimes::print_evacuate_initial_collection_set() const {
   debug_phase(_gc_par_phases[Termination]);
   debug_phase(_gc_par_phases[Other]);
   debug_phase(_gc_par_phases[GCWorkerTotal]);
+  debug_phase(_gc_par_phases[GCWorkerCPUTime]);
   trace_phase(_gc_par_phases[GCWorkerEnd], false);
 
   return _cur_collection_initial_evac_time_ms + _cur_merge_heap_roots_time_ms;
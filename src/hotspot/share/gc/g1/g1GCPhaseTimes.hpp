@@ -70,6 +70,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     OptTermination,
     Other,
     GCWorkerTotal,
+    GCWorkerCPUTime,
     GCWorkerEnd,
     RedirtyCards,
     FreeCollectionSet,
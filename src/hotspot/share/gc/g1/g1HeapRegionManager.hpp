@@ -281,6 +281,9 @@ class G1HeapRegionManager: public CHeapObj<mtGC> {
   // actual number uncommitted.
   uint uncommit_inactive_regions(uint limit);
 
+  // The page size used to commit and uncommit the Java heap.
+  size_t heap_page_size() const { return _heap_mapper->page_size(); }
+
   void verify();
 
   // Do some sanity checking.
@@ -42,6 +42,14 @@ void G1MonotonicArenaMemoryStats::clear() {
   }
 }
 
+size_t G1MonotonicArenaMemoryStats::mem_size() const {
+  size_t result = 0;
+  for (uint i = 0; i < num_pools(); i++) {
+    result += _num_mem_sizes[i];
+  }
+  return result;
+}
+
 void G1MonotonicArenaFreePool::update_unlink_processors(G1ReturnMemoryProcessorSet* unlink_processor) {
 
   for (uint i = 0; i < num_free_lists(); i++) {
@@ -51,6 +51,9 @@ class G1MonotonicArenaMemoryStats {
 
   void clear();
 
+  // Returns the total memory size over all pools.
+  size_t mem_size() const;
+
   uint num_pools() const { return G1CardSetConfiguration::num_mem_object_types(); }
 };
 
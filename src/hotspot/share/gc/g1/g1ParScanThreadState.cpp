@@ -29,6 +29,7 @@
 #include "gc/g1/g1HeapRegionPrinter.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
+#include "gc/g1/g1Pretenuring.inline.hpp"
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1StringDedup.hpp"
 #include "gc/g1/g1Trace.hpp"
@@ -70,6 +71,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _plab_allocator(nullptr),
     _age_table(false),
     _tenuring_threshold(g1h->policy()->tenuring_threshold()),
+    _pretenure_stats(nullptr),
+    _pretenure_table(g1h->policy()->pretenure_table()),
     _scanner(g1h, this),
     _worker_id(worker_id),
     _last_enqueued_card(SIZE_MAX),
@@ -109,6 +112,10 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
 
   _oops_into_optional_regions = new G1OopStarChunkedList[_max_num_optional_regions];
 
+  if (_pretenure_table != nullptr) {
+    _pretenure_stats = new G1PretenureStats();
+  }
+
   initialize_numa_stats();
 }
 
@@ -118,6 +125,9 @@ size_t G1ParScanThreadState::flush_stats(size_t* surviving_young_words, uint num
   // Update allocation statistics.
   _plab_allocator->flush_and_retire_stats(num_workers);
   _g1h->policy()->record_age_table(&_age_table);
+  if (_pretenure_stats != nullptr) {
+    _g1h->policy()->record_pretenure_stats(_pretenure_stats);
+  }
 
   if (_evacuation_failed_info.has_failed()) {
     _g1h->gc_tracer_stw()->report_evacuation_failed(_evacuation_failed_info);
@@ -137,6 +147,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  delete _pretenure_stats;
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -337,13 +348,18 @@ HeapWord* G1ParScanThreadState::allocate_in_next_plab(G1HeapRegionAttr* dest,
   }
 }
 
-G1HeapRegionAttr G1ParScanThreadState::next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, uint& age) {
+G1HeapRegionAttr G1ParScanThreadState::next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, Klass* klass, uint& age) {
   assert(region_attr.is_young() || region_attr.is_old(), "must be either Young or Old");
 
   if (region_attr.is_young()) {
     age = !m.has_displaced_mark_helper() ? m.age()
                                          : m.displaced_mark_helper().age();
-    if (age < _tenuring_threshold) {
+    // Objects of pretenured types still survive once in the survivor regions
+    // to keep their survival statistics up to date.
+    bool pretenure = _pretenure_table != nullptr &&
+                     age > 0 &&
+                     _pretenure_table->should_pretenure(klass);
+    if (age < _tenuring_threshold && !pretenure) {
       return region_attr;
     }
   }
@@ -483,7 +499,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   }
 
   uint age = 0;
-  G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
+  G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, klass, age);
   G1HeapRegion* const from_region = _g1h->heap_region_containing(old);
   uint node_index = from_region->node_index();
 
@@ -530,6 +546,10 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
       _surviving_young_words[young_index] += word_sz;
     }
 
+    if (_pretenure_stats != nullptr && region_attr.is_young()) {
+      _pretenure_stats->record(klass, age, word_sz);
+    }
+
     if (dest_attr.is_young()) {
       if (age < markWord::max_age) {
         age++;
@@ -46,6 +46,8 @@ class G1EvacFailureRegions;
 class G1EvacuationRootClosures;
 class G1OopStarChunkedList;
 class G1PLABAllocator;
+class G1PretenureStats;
+class G1PretenureTable;
 class G1HeapRegion;
 class outputStream;
 
@@ -61,6 +63,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   AgeTable _age_table;
   // Local tenuring threshold.
   uint _tenuring_threshold;
+  // Survival statistics and decisions for G1PretenureByType; null if disabled.
+  G1PretenureStats* _pretenure_stats;
+  const G1PretenureTable* _pretenure_table;
   G1ScanEvacuatedObjClosure _scanner;
 
   uint _worker_id;
@@ -209,7 +214,7 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                                   bool previous_plab_refill_failed,
                                   uint node_index);
 
-  inline G1HeapRegionAttr next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, uint& age);
+  inline G1HeapRegionAttr next_region_attr(G1HeapRegionAttr const region_attr, markWord const m, Klass* klass, uint& age);
 
   void report_promotion_event(G1HeapRegionAttr const dest_attr,
                               Klass* klass, size_t word_sz, uint age,
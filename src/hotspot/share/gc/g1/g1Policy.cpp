@@ -38,7 +38,9 @@
 #include "gc/g1/g1HeapRegionRemSet.inline.hpp"
 #include "gc/g1/g1IHOPControl.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1Pretenuring.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcPolicyCounters.hpp"
@@ -65,10 +67,14 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _survivor_surv_rate_group(new G1SurvRateGroup()),
   _reserve_factor((double) G1ReservePercent / 100.0),
   _reserve_regions(0),
+  _base_reserve_regions(0),
+  _evac_region_usage_ratio_seq(),
+  _humongous_allocation_fragmented(false),
   _young_gen_sizer(),
   _free_regions_at_end_of_collection(0),
   _card_rs_length(0),
   _pending_cards_at_gc_start(0),
+  _predicted_pause_time_ms(0.0),
   _concurrent_start_to_mixed(),
   _collection_set(nullptr),
   _g1h(nullptr),
@@ -76,12 +82,14 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _phase_times(nullptr),
   _tenuring_threshold(MaxTenuringThreshold),
   _max_survivor_regions(0),
-  _survivors_age_table(true)
+  _survivors_age_table(true),
+  _pretenure_table(G1PretenureByType ? new G1PretenureTable() : nullptr)
 {
 }
 
 G1Policy::~G1Policy() {
   delete _ihop_control;
+  delete _pretenure_table;
 }
 
 G1CollectorState* G1Policy::collector_state() const { return _g1h->collector_state(); }
@@ -165,7 +173,11 @@ void G1Policy::record_new_heap_size(uint new_number_of_regions) {
   double reserve_regions_d = (double) new_number_of_regions * _reserve_factor;
   // We use ceiling so that if reserve_regions_d is > 0.0 (but
   // smaller than 1.0) we'll get 1.
-  _reserve_regions = (uint) ceil(reserve_regions_d);
+  _base_reserve_regions = (uint) ceil(reserve_regions_d);
+  _reserve_regions = MAX2(_reserve_regions, _base_reserve_regions);
+  if (!G1UseAdaptiveReserve) {
+    _reserve_regions = _base_reserve_regions;
+  }
 
   _young_gen_sizer.heap_size_changed(new_number_of_regions);
 
@@ -584,6 +596,7 @@ void G1Policy::record_full_collection_end() {
   double end_sec = os::elapsedTime();
 
   collector_state()->set_in_full_gc(false);
+  _humongous_allocation_fragmented = false;
 
   // "Nuke" the heuristics that control the young/mixed GC
   // transitions and make sure we start with young GCs after the Full GC.
@@ -695,6 +708,7 @@ void G1Policy::record_young_collection_start() {
 void G1Policy::record_concurrent_mark_init_end() {
   assert(!collector_state()->initiate_conc_mark_if_possible(), "we should have cleared it by now");
   collector_state()->set_in_concurrent_start_gc(false);
+  _humongous_allocation_fragmented = false;
 }
 
 void G1Policy::record_concurrent_mark_remark_end() {
@@ -735,6 +749,59 @@ bool G1Policy::about_to_start_mixed_phase() const {
   return _g1h->concurrent_mark()->cm_thread()->in_progress() || collector_state()->in_young_gc_before_mixed();
 }
 
+void G1Policy::record_evacuation_region_usage(uint regions_filled, size_t bytes_copied) {
+  if (bytes_copied == 0) {
+    return;
+  }
+  double ratio = (double)regions_filled * G1HeapRegion::GrainBytes / bytes_copied;
+  _evac_region_usage_ratio_seq.add(MAX2(ratio, 1.0));
+}
+
+uint G1Policy::predict_regions_needed_for_evacuation() const {
+  uint const eden_length = young_list_target_length() - _g1h->survivor_regions_count();
+
+  size_t eden_bytes_to_copy = 0;
+  predict_eden_copy_time_ms(eden_length, &eden_bytes_to_copy);
+  // All current survivors are copied again, either to survivor or old regions.
+  size_t const bytes_to_copy = eden_bytes_to_copy + _g1h->survivor()->used_bytes();
+
+  double usage_ratio = 1.0;
+  if (_evac_region_usage_ratio_seq.num() > 0) {
+    usage_ratio = MAX2(_predictor.predict(&_evac_region_usage_ratio_seq), 1.0);
+  }
+  return (uint)ceil(bytes_to_copy * usage_ratio / G1HeapRegion::GrainBytes);
+}
+
+void G1Policy::update_reserve_regions() {
+  uint const max_reserve_regions = (uint)ceil(_g1h->num_committed_regions() * G1AdaptiveReserveMaxPercent / 100.0);
+  uint const predicted_regions = predict_regions_needed_for_evacuation();
+
+  _reserve_regions = clamp(predicted_regions,
+                           _base_reserve_regions,
+                           MAX2(max_reserve_regions, _base_reserve_regions));
+
+  log_debug(gc, ergo, heap)("Heap reserve: %u regions (base %u, predicted needed for evacuation %u, max %u)",
+                            _reserve_regions, _base_reserve_regions, predicted_regions, max_reserve_regions);
+
+  _g1h->gc_tracer_stw()->report_heap_reserve((size_t)_reserve_regions * G1HeapRegion::GrainBytes,
+                                             (size_t)_base_reserve_regions * G1HeapRegion::GrainBytes,
+                                             (size_t)predicted_regions * G1HeapRegion::GrainBytes);
+}
+
+double G1Policy::concurrent_rebuild_duty_cycle() const {
+  double const duty_cycle = G1RebuildRemSetDutyCyclePercent / 100.0;
+  if (duty_cycle < 1.0) {
+    // Mixed collections need the rebuilt remembered sets to reclaim old
+    // regions. Do not throttle if only the reserve and the next young
+    // generation are left.
+    uint const regions_needed = _reserve_regions + young_list_target_length();
+    if (_g1h->num_available_regions() <= regions_needed) {
+      return 1.0;
+    }
+  }
+  return duty_cycle;
+}
+
 bool G1Policy::need_to_start_conc_mark(const char* source, size_t alloc_word_size) {
   if (about_to_start_mixed_phase()) {
     return false;
@@ -752,10 +819,24 @@ bool G1Policy::need_to_start_conc_mark(const char* source, size_t alloc_word_siz
     log_debug(gc, ergo, ihop)("%s occupancy: %zuB allocation request: %zuB threshold: %zuB (%1.2f) source: %s",
                               result ? "Request concurrent cycle initiation (occupancy higher than threshold)" : "Do not request concurrent cycle initiation (still doing mixed collections)",
                               cur_used_bytes, alloc_byte_size, marking_initiating_used_threshold, (double) marking_initiating_used_threshold / _g1h->capacity() * 100, source);
+  } else if (_humongous_allocation_fragmented && collector_state()->in_young_only_phase()) {
+    log_debug(gc, ergo, ihop)("Request concurrent cycle initiation (humongous allocation failed due to fragmentation) "
+                              "occupancy: %zuB allocation request: %zuB source: %s",
+                              cur_used_bytes, alloc_byte_size, source);
+    result = true;
   }
   return result;
 }
 
+void G1Policy::record_humongous_allocation_fragmented(size_t alloc_word_size) {
+  if (G1MarkOnHumongousFragmentation && !_humongous_allocation_fragmented) {
+    log_debug(gc, ergo, heap)("Humongous allocation failed due to fragmentation. "
+                              "Allocation request: %zuB available regions: %u",
+                              alloc_word_size * HeapWordSize, _g1h->num_available_regions());
+    _humongous_allocation_fragmented = true;
+  }
+}
+
 bool G1Policy::concurrent_operation_is_full_mark(const char* msg) {
   return collector_state()->in_concurrent_start_gc() &&
     ((_g1h->gc_cause() != GCCause::_g1_humongous_allocation) || need_to_start_conc_mark(msg));
@@ -794,6 +875,10 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
   double end_time_sec = Ticks::now().seconds();
   double pause_time_ms = (end_time_sec - start_time_sec) * 1000.0;
 
+  log_debug(gc, ergo)("Pause time prediction: predicted %1.2fms actual %1.2fms error %1.2fms%s",
+                      _predicted_pause_time_ms, pause_time_ms, pause_time_ms - _predicted_pause_time_ms,
+                      allocation_failure ? " (evacuation failed)" : "");
+
   G1GCPauseType this_pause = collector_state()->young_gc_pause_type(concurrent_operation_is_full_mark);
   bool is_young_only_pause = G1GCPauseTypeHelper::is_young_only_pause(this_pause);
 
@@ -941,6 +1026,10 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
 
   _free_regions_at_end_of_collection = _g1h->num_free_regions();
 
+  if (G1UseAdaptiveReserve) {
+    update_reserve_regions();
+  }
+
   // Do not update dynamic IHOP due to G1 periodic collection as it is highly likely
   // that in this case we are not running in a "normal" operating mode.
   if (_g1h->gc_cause() != GCCause::_g1_periodic_collection) {
@@ -1176,6 +1265,17 @@ void G1Policy::print_age_table() {
   _survivors_age_table.print_age_table();
 }
 
+void G1Policy::record_pretenure_stats(const G1PretenureStats* stats) {
+  assert(_pretenure_table != nullptr, "must be");
+  _pretenure_table->merge(stats);
+}
+
+void G1Policy::clear_pretenure_table() {
+  if (_pretenure_table != nullptr) {
+    _pretenure_table->clear();
+  }
+}
+
 // Calculates survivor space parameters.
 void G1Policy::update_survivors_policy() {
   double max_survivor_regions_d =
@@ -1196,6 +1296,10 @@ void G1Policy::update_survivors_policy() {
   // be allocated into.
   _max_survivor_regions = MIN2(desired_max_survivor_regions,
                                _g1h->num_available_regions());
+
+  if (_pretenure_table != nullptr) {
+    _pretenure_table->update();
+  }
 }
 
 bool G1Policy::force_concurrent_start_if_outside_cycle(GCCause::Cause gc_cause) {
@@ -36,6 +36,7 @@
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/gcCause.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/numberSeq.hpp"
 #include "utilities/pair.hpp"
 #include "utilities/ticks.hpp"
 
@@ -49,6 +50,8 @@ class G1CollectionSet;
 class G1CollectionSetCandidates;
 class G1CollectionSetChooser;
 class G1IHOPControl;
+class G1PretenureStats;
+class G1PretenureTable;
 class G1Analytics;
 class G1SurvivorRegions;
 class GCPolicyCounters;
@@ -96,6 +99,19 @@ class G1Policy: public CHeapObj<mtGC> {
   // This will be set when the heap is expanded
   // for the first time during initialization.
   uint   _reserve_regions;
+  // The reserve as given by _reserve_factor. With G1UseAdaptiveReserve,
+  // _reserve_regions may be larger.
+  uint   _base_reserve_regions;
+
+  // Ratio between the space in regions used for evacuation and the bytes
+  // actually copied in recent young collections, i.e. accounting for PLAB and
+  // region end waste.
+  TruncatedSeq _evac_region_usage_ratio_seq;
+
+  // Whether a humongous allocation failed because there were enough free
+  // regions, but no contiguous range of them large enough, since the start
+  // of the last concurrent mark cycle or Full GC.
+  bool _humongous_allocation_fragmented;
 
   G1YoungGenSizer _young_gen_sizer;
 
@@ -105,6 +121,10 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Predicted time of the current pause, summed up while choosing the
+  // collection set. Compared to the actual pause time at the end of the pause.
+  double _predicted_pause_time_ms;
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -112,6 +132,12 @@ class G1Policy: public CHeapObj<mtGC> {
   }
 
   double logged_cards_processing_time() const;
+
+  // Number of regions predicted to be needed as survivor or old regions for
+  // evacuating the young generation at the next collection.
+  uint predict_regions_needed_for_evacuation() const;
+  // Recalculate the reserve based on the predicted regions needed and report it.
+  void update_reserve_regions();
 public:
   const G1Predictions& predictor() const { return _predictor; }
   const G1Analytics* analytics()   const { return const_cast<const G1Analytics*>(_analytics); }
@@ -242,6 +268,9 @@ class G1Policy: public CHeapObj<mtGC> {
   size_t predict_bytes_to_copy(G1HeapRegion* hr) const;
   size_t pending_cards_at_gc_start() const { return _pending_cards_at_gc_start; }
 
+  void record_predicted_pause_time_ms(double ms) { _predicted_pause_time_ms = ms; }
+  void add_predicted_pause_time_ms(double ms) { _predicted_pause_time_ms += ms; }
+
   // GC efficiency for collecting the region based on the time estimate for
   // merging and scanning incoming references.
   double predict_gc_efficiency(G1HeapRegion* hr);
@@ -292,6 +321,12 @@ class G1Policy: public CHeapObj<mtGC> {
   // This should be called after the heap is resized.
   void record_new_heap_size(uint new_number_of_regions);
 
+  // Record how many regions the last evacuation used for copying the given
+  // amount of bytes.
+  void record_evacuation_region_usage(uint regions_filled, size_t bytes_copied);
+
+  uint reserve_regions() const { return _reserve_regions; }
+
   void init(G1CollectedHeap* g1h, G1CollectionSet* collection_set);
 
   // Record the start and end of the young gc pause.
@@ -300,10 +335,18 @@ class G1Policy: public CHeapObj<mtGC> {
 
   bool need_to_start_conc_mark(const char* source, size_t alloc_word_size = 0);
 
+  // Record that a humongous allocation of the given size failed due to
+  // fragmentation of the free regions.
+  void record_humongous_allocation_fragmented(size_t alloc_word_size);
+
   bool concurrent_operation_is_full_mark(const char* msg = nullptr);
 
   bool about_to_start_mixed_phase() const;
 
+  // Fraction of time the concurrent remembered set rebuild and scrubbing may
+  // use per worker thread; 1.0 means no throttling.
+  double concurrent_rebuild_duty_cycle() const;
+
   // Record the start and end of the actual collection part of the evacuation pause.
   void record_pause_start_time();
   void record_young_collection_start();
@@ -391,6 +434,9 @@ class G1Policy: public CHeapObj<mtGC> {
 
   AgeTable _survivors_age_table;
 
+  // Per type survival statistics if G1PretenureByType is enabled, null otherwise.
+  G1PretenureTable* _pretenure_table;
+
   size_t desired_survivor_size(uint max_regions) const;
 
 public:
@@ -424,6 +470,13 @@ class G1Policy: public CHeapObj<mtGC> {
     _survivors_age_table.merge(age_table);
   }
 
+  const G1PretenureTable* pretenure_table() const { return _pretenure_table; }
+
+  void record_pretenure_stats(const G1PretenureStats* stats);
+
+  // Forget the per type survival statistics, e.g. after class unloading.
+  void clear_pretenure_table();
+
   void print_age_table();
 
   void update_survivors_policy();
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "gc/g1/g1Pretenuring.inline.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
+
+G1PretenureStats::G1PretenureStats() :
+  _entries(NEW_C_HEAP_ARRAY(Entry, TableSize, mtGC)),
+  _samples_countdown(G1PretenureSampleInterval) {
+  reset();
+}
+
+G1PretenureStats::~G1PretenureStats() {
+  FREE_C_HEAP_ARRAY(Entry, _entries);
+}
+
+void G1PretenureStats::reset() {
+  for (uint i = 0; i < TableSize; i++) {
+    _entries[i] = { nullptr, 0, 0 };
+  }
+}
+
+G1PretenureTable::G1PretenureTable() :
+  _entries(NEW_C_HEAP_ARRAY(Entry, G1PretenureStats::TableSize, mtGC)) {
+  clear();
+}
+
+G1PretenureTable::~G1PretenureTable() {
+  FREE_C_HEAP_ARRAY(Entry, _entries);
+}
+
+void G1PretenureTable::clear() {
+  for (uint i = 0; i < G1PretenureStats::TableSize; i++) {
+    _entries[i] = { nullptr, 0.0, 0.0, false };
+  }
+}
+
+void G1PretenureTable::merge(const G1PretenureStats* stats) {
+  for (uint i = 0; i < G1PretenureStats::TableSize; i++) {
+    const G1PretenureStats::Entry* from = &stats->_entries[i];
+    if (from->_klass == nullptr) {
+      continue;
+    }
+    Entry* e = &_entries[i];
+    if (e->_klass != from->_klass) {
+      // Keep the type with the larger recent survival volume.
+      if (e->_klass != nullptr && e->_age0_words >= from->_age0_words) {
+        continue;
+      }
+      *e = { from->_klass, 0.0, 0.0, false };
+    }
+    e->_age0_words += from->_age0_words;
+    e->_age1_words += from->_age1_words;
+  }
+}
+
+void G1PretenureTable::update() {
+  // Weight of the statistics of previous collections.
+  const double DecayFactor = 0.5;
+  // Minimum number of sampled words of first survivors for a decision.
+  const double MinSampledWords = 64 * K;
+
+  const double survival_limit = G1PretenureSurvivalPercent / 100.0;
+  uint num_pretenured = 0;
+
+  for (uint i = 0; i < G1PretenureStats::TableSize; i++) {
+    Entry* e = &_entries[i];
+    if (e->_klass == nullptr) {
+      continue;
+    }
+    if (e->_age0_words >= MinSampledWords) {
+      // Pretenured objects are copied into survivor regions at age 0 too, so
+      // this ratio is available regardless of the current decision.
+      e->_pretenure = e->_age1_words >= e->_age0_words * survival_limit;
+    }
+    if (e->_pretenure) {
+      num_pretenured++;
+    }
+    e->_age0_words *= DecayFactor;
+    e->_age1_words *= DecayFactor;
+  }
+  log_debug(gc, age)("Pretenuring %u types", num_pretenured);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PRETENURING_HPP
+#define SHARE_GC_G1_G1PRETENURING_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Klass;
+
+// Survival statistics per type (Klass) used to copy objects of long-lived
+// types directly into old regions instead of aging them in the survivor
+// regions up to the tenuring threshold.
+//
+// During evacuation each worker samples the words copied out of young
+// regions for objects of age 0 (first survival) and age 1 (second survival)
+// into a thread-local G1PretenureStats. These are merged into the global
+// G1PretenureTable at the end of the pause, which then decides which types
+// to pretenure: if most of the objects of a type that survive their first
+// collection also survive the next one, then these objects are likely to
+// survive until the tenuring threshold too. Objects of pretenured types are
+// still copied into survivor regions at age 0, so that the statistics stay
+// meaningful, but copied to old regions from age 1 on.
+//
+// Both tables are direct mapped hash tables indexed by Klass*; colliding
+// types simply replace each other.
+class G1PretenureStats : public CHeapObj<mtGC> {
+  friend class G1PretenureTable;
+
+  struct Entry {
+    Klass* _klass;
+    size_t _age0_words;
+    size_t _age1_words;
+  };
+
+  Entry* _entries;
+  // Number of copies until the next sample.
+  uint _samples_countdown;
+
+public:
+  static const uint TableSize = 512;
+
+  static uint index_for(const Klass* klass) {
+    return (uint)(((uintptr_t)klass >> LogBytesPerWord) % TableSize);
+  }
+
+  G1PretenureStats();
+  ~G1PretenureStats();
+
+  // Record words copied for an object of the given type and age, subject to
+  // sampling.
+  inline void record(Klass* klass, uint age, size_t word_sz);
+
+  void reset();
+};
+
+class G1PretenureTable : public CHeapObj<mtGC> {
+  struct Entry {
+    Klass* _klass;
+    // Decayed average of sampled words copied at age 0 and 1 respectively.
+    double _age0_words;
+    double _age1_words;
+    bool _pretenure;
+  };
+
+  Entry* _entries;
+  Entry* entry_for(const Klass* klass) const {
+    return &_entries[G1PretenureStats::index_for(klass)];
+  }
+
+public:
+  G1PretenureTable();
+  ~G1PretenureTable();
+
+  // Returns whether objects of the given type that already survived a young
+  // collection should be copied into old regions. Read-only during evacuation.
+  bool should_pretenure(const Klass* klass) const {
+    const Entry* e = entry_for(klass);
+    return e->_klass == klass && e->_pretenure;
+  }
+
+  // Merge the given thread-local statistics into this table.
+  void merge(const G1PretenureStats* stats);
+  // Update pretenuring decisions after all statistics of a young collection
+  // have been merged.
+  void update();
+  // Forget all types, e.g. after classes have been unloaded.
+  void clear();
+};
+
+#endif // SHARE_GC_G1_G1PRETENURING_HPP
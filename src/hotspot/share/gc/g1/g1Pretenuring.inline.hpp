@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PRETENURING_INLINE_HPP
+#define SHARE_GC_G1_G1PRETENURING_INLINE_HPP
+
+#include "gc/g1/g1Pretenuring.hpp"
+
+#include "gc/shared/gc_globals.hpp"
+
+inline void G1PretenureStats::record(Klass* klass, uint age, size_t word_sz) {
+  if (age > 1) {
+    return;
+  }
+  if (--_samples_countdown > 0) {
+    return;
+  }
+  _samples_countdown = G1PretenureSampleInterval;
+
+  Entry* e = &_entries[index_for(klass)];
+  if (e->_klass != klass) {
+    e->_klass = klass;
+    e->_age0_words = 0;
+    e->_age1_words = 0;
+  }
+  if (age == 0) {
+    e->_age0_words += word_sz;
+  } else {
+    e->_age1_words += word_sz;
+  }
+}
+
+#endif // SHARE_GC_G1_G1PRETENURING_INLINE_HPP
@@ -63,6 +63,7 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
 
   size_t reserved_size() { return _storage.reserved_size(); }
   size_t committed_size() { return _storage.committed_size(); }
+  size_t page_size() const { return _storage.page_size(); }
 
   void set_mapping_changed_listener(G1MappingChangedListener* listener) { _listener = listener; }
 
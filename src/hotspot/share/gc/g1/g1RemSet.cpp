@@ -38,6 +38,7 @@
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/g1/g1HeapRegionManager.inline.hpp"
 #include "gc/g1/g1HeapRegionRemSet.inline.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1RemSet.hpp"
@@ -54,6 +55,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -378,6 +381,19 @@ class G1RemSetScanState : public CHeapObj<mtGC> {
     uint const max_workers = workers->active_workers();
 
     uint const start_pos = num_regions * worker_id / max_workers;
+
+    // With NUMA, first scan the regions located on the node of this worker,
+    // then help out with the remaining (remote) regions. Regions visited in
+    // the first pass have typically been fully claimed by the time the
+    // second pass gets to them, so they are skipped cheaply.
+    G1NUMA* numa = g1h->numa();
+    if (numa->is_enabled()) {
+      uint const node_index = numa->index_of_current_thread();
+      if (node_index != G1NUMA::UnknownNodeIndex) {
+        iterate_dirty_regions_on_node(cl, start_pos, node_index);
+      }
+    }
+
     uint cur = start_pos;
 
     do {
@@ -390,6 +406,24 @@ class G1RemSetScanState : public CHeapObj<mtGC> {
     } while (cur != start_pos);
   }
 
+  void iterate_dirty_regions_on_node(G1HeapRegionClosure* cl, uint start_pos, uint node_index) {
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    uint const num_regions = _next_dirty_regions->size();
+    uint cur = start_pos;
+
+    do {
+      G1HeapRegion* r = g1h->region_at(_next_dirty_regions->at(cur));
+      if (r->node_index() == node_index) {
+        bool result = cl->do_heap_region(r);
+        guarantee(!result, "Not allowed to ask for early termination.");
+      }
+      cur++;
+      if (cur == num_regions) {
+        cur = 0;
+      }
+    } while (cur != start_pos);
+  }
+
   bool has_cards_to_scan(uint region) {
     assert(region < _max_reserved_regions, "Tried to access invalid region %u", region);
     return _card_table_scan_state[region] < G1HeapRegion::CardsPerRegion;
@@ -559,56 +593,76 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
-    CardValue* find_first_dirty_card(CardValue* i_card) const {
-      while (!is_word_aligned(i_card)) {
-        if (is_card_dirty(i_card)) {
-          return i_card;
+    // Number of words examined together when skipping over long runs of cards
+    // that do not match. Combining the words before testing keeps the loop free
+    // of data dependent branches, which lets the compiler use vector instructions.
+    static const uint WordsPerStride = 4;
+
+    // Returns the index of the first card within a word whose LSB is set in
+    // the non-zero marks.
+    static uint index_of_first_marked_card(Word marks) {
+      assert(marks != 0, "precondition");
+      uint const bit = LITTLE_ENDIAN_ONLY(count_trailing_zeros(marks))
+                       BIG_ENDIAN_ONLY(count_leading_zeros(marks));
+      return bit / BitsPerByte;
+    }
+
+    // Returns a word with the LSB of each card set if that card is dirty.
+    static Word dirty_card_marks(Word word_value) {
+      return ~word_value & ExpandedToScanMask;
+    }
+
+    // Returns a word with the LSB of each card set if that card is not dirty.
+    static Word non_dirty_card_marks(Word word_value) {
+      return word_value & ExpandedToScanMask;
+    }
+
+    template <Word MarksFn(Word)>
+    CardValue* find_first_card(CardValue* i_card) const {
+      assert(is_word_aligned(i_card), "precondition");
+
+      Word const* i_word = reinterpret_cast<Word const*>(i_card);
+      Word const* const end_word = reinterpret_cast<Word const*>(_end_card);
+
+      while (pointer_delta(end_word, i_word, sizeof(Word)) >= WordsPerStride) {
+        Word combined = 0;
+        for (uint i = 0; i < WordsPerStride; ++i) {
+          combined |= MarksFn(i_word[i]);
         }
-        i_card++;
+        if (combined != 0) {
+          break;
+        }
+        i_word += WordsPerStride;
       }
 
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+      for (/* empty */; i_word < end_word; ++i_word) {
+        Word marks = MarksFn(*i_word);
+        if (marks != 0) {
+          return (CardValue*)i_word + index_of_first_marked_card(marks);
         }
       }
 
       return _end_card;
     }
 
-    CardValue* find_first_non_dirty_card(CardValue* i_card) const {
+    CardValue* find_first_dirty_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
-        if (!is_card_dirty(i_card)) {
+        if (is_card_dirty(i_card)) {
           return i_card;
         }
         i_card++;
       }
+      return find_first_card<dirty_card_marks>(i_card);
+    }
 
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+    CardValue* find_first_non_dirty_card(CardValue* i_card) const {
+      while (!is_word_aligned(i_card)) {
+        if (!is_card_dirty(i_card)) {
+          return i_card;
         }
+        i_card++;
       }
-
-      return _end_card;
+      return find_first_card<non_dirty_card_marks>(i_card);
     }
 
   public:
@@ -1401,12 +1455,6 @@ class G1MergeHeapRootsTask : public WorkerTask {
       }
     }
 
-    // Preparation for evacuation failure handling.
-    {
-      G1ClearBitmapClosure clear(g1h, _scan_state);
-      g1h->collection_set_iterate_increment_from(&clear, &_hr_claimer, worker_id);
-    }
-
     // Now apply the closure to all remaining log entries.
     if (_initial_evacuation) {
       assert(merge_remset_phase == G1GCPhaseTimes::MergeRS, "Wrong merge phase");
@@ -1418,6 +1466,15 @@ class G1MergeHeapRootsTask : public WorkerTask {
       p->record_thread_work_item(G1GCPhaseTimes::MergeLB, worker_id, cl.cards_dirty(), G1GCPhaseTimes::MergeLBDirtyCards);
       p->record_thread_work_item(G1GCPhaseTimes::MergeLB, worker_id, cl.cards_skipped(), G1GCPhaseTimes::MergeLBSkippedCards);
     }
+
+    // Preparation for evacuation failure handling.
+    // This work does not depend on any of the merging above and is claimed per
+    // region, so doing it last lets workers that finished merging early pick up
+    // the remainder instead of idling until the slowest merging worker is done.
+    {
+      G1ClearBitmapClosure clear(g1h, _scan_state);
+      g1h->collection_set_iterate_increment_from(&clear, &_hr_claimer, worker_id);
+    }
   }
 };
 
@@ -126,6 +126,12 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_heap_reserve(size_t reserve_size,
+                                      size_t base_reserve_size,
+                                      size_t predicted_evacuation_size) {
+  send_heap_reserve(reserve_size, base_reserve_size, predicted_evacuation_size);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -247,6 +253,19 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_heap_reserve(size_t reserve_size,
+                                    size_t base_reserve_size,
+                                    size_t predicted_evacuation_size) {
+  EventG1HeapReserve evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_reserveSize(reserve_size);
+    evt.set_baseReserveSize(base_reserve_size);
+    evt.set_predictedEvacuationSize(predicted_evacuation_size);
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
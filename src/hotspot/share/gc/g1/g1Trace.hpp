@@ -63,6 +63,9 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_heap_reserve(size_t reserve_size,
+                           size_t base_reserve_size,
+                           size_t predicted_evacuation_size);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacInfo* info);
@@ -84,6 +87,9 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_heap_reserve(size_t reserve_size,
+                         size_t base_reserve_size,
+                         size_t predicted_evacuation_size);
 };
 
 class G1OldTracer : public OldGCTracer, public CHeapObj<mtGC> {
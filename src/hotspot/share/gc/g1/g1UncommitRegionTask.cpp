@@ -58,9 +58,9 @@ void G1UncommitRegionTask::enqueue() {
 
   G1UncommitRegionTask* uncommit_task = instance();
   if (!uncommit_task->is_active()) {
-    // Change state to active and schedule using UncommitInitialDelayMs.
+    // Change state to active and schedule using G1UncommitDelayMillis.
     uncommit_task->set_active(true);
-    G1CollectedHeap::heap()->service_thread()->schedule_task(uncommit_task, UncommitInitialDelayMs);
+    G1CollectedHeap::heap()->service_thread()->schedule_task(uncommit_task, G1UncommitDelayMillis);
   }
 }
 
@@ -104,14 +104,15 @@ void G1UncommitRegionTask::clear_summary() {
 void G1UncommitRegionTask::execute() {
   assert(_active, "Must be active");
 
-  // Translate the size limit into a number of regions. This cannot be a
-  // compile time constant because G1HeapRegionSize is set ergonomically.
-  static const uint region_limit = (uint) (UncommitSizeLimit / G1HeapRegionSize);
-
   // Prevent from running during a GC pause.
   SuspendibleThreadSetJoiner sts;
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
+  // Translate the size limit into a number of regions. This cannot be a
+  // compile time constant because G1HeapRegionSize is set ergonomically.
+  static const uint region_limit =
+    (uint) (MAX2((size_t)UncommitSizeLimit, g1h->heap_page_size()) / G1HeapRegionSize);
+
   Ticks start = Ticks::now();
   uint uncommit_count = g1h->uncommit_regions(region_limit);
   Tickspan uncommit_time = (Ticks::now() - start);
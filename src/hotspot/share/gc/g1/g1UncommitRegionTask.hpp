@@ -30,12 +30,12 @@
 #include "utilities/ticks.hpp"
 
 class G1UncommitRegionTask : public G1ServiceTask {
-  // Each execution of the uncommit task is limited to uncommit at most 128M.
-  // This limit is small enough to ensure that the duration of each invocation
-  // is short, while still making reasonable progress.
+  // Each execution of the uncommit task is limited to uncommit at most 128M,
+  // or a single heap page if that is larger. This limit is small enough to
+  // ensure that the duration of each invocation is short, while still making
+  // reasonable progress, and regions backed by a large page are returned to
+  // the OS in a single execution.
   static const uint UncommitSizeLimit = 128 * M;
-  // Initial delay in milliseconds after GC before the regions are uncommitted.
-  static const uint UncommitInitialDelayMs = 100;
   // The delay between two uncommit task executions.
   static const uint UncommitTaskDelayMs = 10;
 
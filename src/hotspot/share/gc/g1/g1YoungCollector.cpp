@@ -58,6 +58,7 @@
 #include "gc/shared/workerThread.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
 #include "runtime/threads.hpp"
 #include "utilities/ticks.hpp"
 
@@ -720,12 +721,28 @@ class G1EvacuateRegionsTask : public G1EvacuateRegionsBaseTask {
     G1EvacuateRegionsBaseTask::evacuate_live_objects(pss, worker_id, G1GCPhaseTimes::ObjCopy, G1GCPhaseTimes::Termination);
   }
 
+  static double thread_cpu_time_secs() {
+    return (double)os::current_thread_cpu_time() / NANOSECS_PER_SEC;
+  }
+
   void start_work(uint worker_id) {
-    _g1h->phase_times()->record_time_secs(G1GCPhaseTimes::GCWorkerStart, worker_id, Ticks::now().seconds());
+    G1GCPhaseTimes* p = _g1h->phase_times();
+    p->record_time_secs(G1GCPhaseTimes::GCWorkerStart, worker_id, Ticks::now().seconds());
+    // Record the negated CPU time of the worker thread at the start, so that
+    // adding the CPU time at the end yields the CPU time spent in between.
+    // Comparing it with GC Worker Total shows how long the worker was not
+    // running, e.g. because it was descheduled.
+    if (os::is_thread_cpu_time_supported()) {
+      p->record_time_secs(G1GCPhaseTimes::GCWorkerCPUTime, worker_id, -thread_cpu_time_secs());
+    }
   }
 
   void end_work(uint worker_id) {
-    _g1h->phase_times()->record_time_secs(G1GCPhaseTimes::GCWorkerEnd, worker_id, Ticks::now().seconds());
+    G1GCPhaseTimes* p = _g1h->phase_times();
+    if (os::is_thread_cpu_time_supported()) {
+      p->add_time_secs(G1GCPhaseTimes::GCWorkerCPUTime, worker_id, thread_cpu_time_secs());
+    }
+    p->record_time_secs(G1GCPhaseTimes::GCWorkerEnd, worker_id, Ticks::now().seconds());
   }
 
 public:
@@ -237,6 +237,17 @@
           "set container.")                                                 \
           range(1, 100)                                                     \
                                                                             \
+  product(bool, G1RemSetAdaptiveCoarsening, false, EXPERIMENTAL,            \
+          "Adjust the Howl coarsening thresholds after every young "        \
+          "collection based on recent coarsenings and the memory used by "  \
+          "the remembered sets of collection set candidates.")              \
+                                                                            \
+  product(uint, G1RemSetAdaptiveCoarseningMemoryPercent, 5, EXPERIMENTAL,   \
+          "Target upper bound of remembered set memory usage of "           \
+          "collection set candidates as percentage of the heap capacity "   \
+          "used by G1RemSetAdaptiveCoarsening.")                            \
+          range(1, 100)                                                     \
+                                                                            \
   develop(size_t, G1MaxVerifyFailures, SIZE_MAX,                            \
           "The maximum number of liveness and remembered set verification " \
           "failures to print per thread.")                                  \
@@ -247,6 +258,49 @@
           "to minimize the probability of promotion failure.")              \
           range(0, 50)                                                      \
                                                                             \
+  product(bool, G1UseAdaptiveReserve, false, EXPERIMENTAL,                  \
+          "Grow the heap reserve beyond G1ReservePercent if the regions "   \
+          "predicted to be needed for evacuating the next young "           \
+          "collection exceed it.")                                          \
+                                                                            \
+  product(uint, G1AdaptiveReserveMaxPercent, 30, EXPERIMENTAL,              \
+          "Upper bound of the heap reserve as a percentage of the heap "    \
+          "if G1UseAdaptiveReserve is enabled.")                            \
+          range(0, 50)                                                      \
+                                                                            \
+  product(bool, G1PretenureByType, false, EXPERIMENTAL,                     \
+          "Copy objects of types whose instances mostly survive their "     \
+          "second young collection directly into old regions on their "     \
+          "second survival instead of aging them in survivor regions.")     \
+                                                                            \
+  product(uint, G1PretenureSurvivalPercent, 80, EXPERIMENTAL,               \
+          "Percentage of sampled words of a type surviving their first "    \
+          "young collection that must also survive their second for "       \
+          "that type to be pretenured if G1PretenureByType is enabled.")    \
+          range(1, 100)                                                     \
+                                                                            \
+  product(uint, G1PretenureSampleInterval, 16, EXPERIMENTAL,                \
+          "Sample every n-th object copied out of young regions for "       \
+          "the survival statistics used by G1PretenureByType.")             \
+          range(1, max_jint)                                                \
+                                                                            \
+  product(bool, G1MarkOnHumongousFragmentation, false, EXPERIMENTAL,        \
+          "Start a concurrent marking cycle if a humongous allocation "     \
+          "fails because the free regions are too fragmented, so that "     \
+          "the following mixed collections can compact the old "            \
+          "generation before a Full GC becomes necessary.")                 \
+                                                                            \
+  product(uint, G1UncommitDelayMillis, 100, EXPERIMENTAL,                   \
+          "Time in milliseconds that regions removed from the heap stay "   \
+          "committed after a GC before they are uncommitted. Regions "      \
+          "are reused without recommitting if the heap expands again "      \
+          "within this time.")                                              \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(bool, G1ConcurrentClassUnloadingPurge, false, EXPERIMENTAL,       \
+          "Free unloaded nmethods and purge unloaded class loader data "    \
+          "concurrently after the Remark pause instead of during it.")      \
+                                                                            \
   product(size_t, G1HeapRegionSize, 0,                                      \
           "Size of the G1 regions.")                                        \
           range(0, NOT_LP64(32*M) LP64_ONLY(512*M))                         \
@@ -299,6 +353,18 @@
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  product(uint, G1RebuildRemSetDutyCyclePercent, 100, EXPERIMENTAL,         \
+          "Maximum percentage of time a worker thread spends rebuilding "   \
+          "remembered sets and scrubbing during concurrent marking. The "   \
+          "workers pause after each time slice to stay within this "        \
+          "budget unless the heap is about to run out of free regions.")    \
+          range(1, 100)                                                     \
+                                                                            \
+  product(uint, G1RebuildRemSetSliceMillis, 10, EXPERIMENTAL,               \
+          "Thread CPU time in milliseconds after which a worker thread "    \
+          "pauses if G1RebuildRemSetDutyCyclePercent is less than 100.")    \
+          range(1, 1000)                                                    \
+                                                                            \
   product(uint, G1OldCSetRegionThresholdPercent, 10, EXPERIMENTAL,         \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
@@ -40,6 +40,14 @@
           "Use maximum compaction in the Parallel Old garbage collector "   \
           "for a system GC")                                                \
                                                                             \
+  product(size_t, PSNUMAPromotionPLABSize, 0, EXPERIMENTAL,                 \
+          "With UseNUMA, size (in HeapWords) of old generation promotion "  \
+          "LABs whose pages are placed on the NUMA node of the promoting "  \
+          "GC thread, instead of being interleaved across all nodes. "      \
+          "0 disables this, and old generation promotion LABs have size "   \
+          "OldPLABSize")                                                    \
+          range(0, max_uintx)                                               \
+                                                                            \
   product(bool, PSChunkLargeArrays, true,                                   \
           "(Deprecated) Process large arrays in chunks")
 
@@ -110,6 +110,7 @@ void PSCardTable::scan_obj_with_limit(PSPromotionManager* pm,
 
 void PSCardTable::pre_scavenge(uint active_workers) {
   _preprocessing_active_workers = active_workers;
+  _next_stripe_to_scan = 0;
 }
 
 // The "shadow" table is a copy of the card table entries of the current stripe.
@@ -337,17 +338,22 @@ void PSCardTable::preprocess_card_table_parallel(Func&& object_start,
 //      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes. After finishing
-// stripe 0 in slice 0, the thread finds the stripe 0 in slice 1 by adding
-// slice_size_in_words to the start of stripe 0 in slice 0 to get to the start
-// of stripe 0 in slice 1.
+// In this case there are 4 threads, so 4 stripes.  During preprocessing, a GC
+// thread first works on its stripe within slice 0 and then moves to its stripe
+// in the next slice until it has exceeded the top of the generation.  The
+// distance to stripe in the next slice is calculated based on the number of
+// stripes. After finishing stripe 0 in slice 0, the thread finds the stripe 0
+// in slice 1 by adding slice_size_in_words to the start of stripe 0 in slice 0
+// to get to the start of stripe 0 in slice 1.
+//
+// The scavenge itself does not use this fixed assignment. Dirty cards tend to
+// cluster, e.g. in a large, frequently updated object array, so the threads
+// claim stripes one at a time in ascending address order instead. A thread
+// that finds mostly clean stripes then takes over more of the remaining ones.
 
 // Scavenging and accesses to the card table are strictly limited to the stripe.
 // In particular scavenging of an object crossing stripe boundaries is shared
-// among the threads assigned to the stripes it resides on. This reduces
+// among the threads that claim the stripes it resides on. This reduces
 // complexity and enables shared scanning of large objects.
 // It requires preprocessing of the card table though where imprecise card marks of
 // objects crossing stripe boundaries are propagated to the first card of
@@ -389,14 +395,16 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     spin_yield.wait();
   }
 
-  // Scavenge
+  // Scavenge. Every thread claims stripes in ascending order, so the queries
+  // to object_start stay monotonic.
   cached_obj = {nullptr, old_gen_bottom};
   const size_t stripe_size_in_words = num_cards_in_stripe * _card_size_in_words;
-  const size_t slice_size_in_words = stripe_size_in_words * n_stripes;
-  HeapWord* cur_addr = old_gen_bottom + stripe_index * stripe_size_in_words;
-  for (/* empty */; cur_addr < old_gen_top; cur_addr += slice_size_in_words) {
-    HeapWord* const stripe_l = cur_addr;
-    HeapWord* const stripe_r = MIN2(cur_addr + stripe_size_in_words,
+  const size_t num_stripes_total = align_up(pointer_delta(old_gen_top, old_gen_bottom), stripe_size_in_words) / stripe_size_in_words;
+  for (size_t stripe = Atomic::fetch_then_add(&_next_stripe_to_scan, size_t(1));
+       stripe < num_stripes_total;
+       stripe = Atomic::fetch_then_add(&_next_stripe_to_scan, size_t(1))) {
+    HeapWord* const stripe_l = old_gen_bottom + stripe * stripe_size_in_words;
+    HeapWord* const stripe_r = MIN2(stripe_l + stripe_size_in_words,
                                     old_gen_top);
 
     process_range(object_start, pm, stripe_l, stripe_r);
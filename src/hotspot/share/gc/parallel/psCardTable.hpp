@@ -38,6 +38,8 @@ class PSCardTable: public CardTable {
   static_assert(num_cards_in_stripe >= 1, "progress");
 
   volatile int _preprocessing_active_workers;
+  // Index of the next stripe to be claimed for scavenging.
+  volatile size_t _next_stripe_to_scan;
 
   bool is_dirty(CardValue* card) {
     return !is_clean(card);
@@ -70,11 +72,13 @@ class PSCardTable: public CardTable {
 
  public:
   PSCardTable(MemRegion whole_heap) : CardTable(whole_heap),
-                                      _preprocessing_active_workers(0) {}
+                                      _preprocessing_active_workers(0),
+                                      _next_stripe_to_scan(0) {}
 
   // Scavenge support
   void pre_scavenge(uint active_workers);
-  // Scavenge contents of stripes with the given index.
+  // Preprocess the stripes with the given index, then scavenge the contents
+  // of stripes claimed from all stripes of the old gen.
   void scavenge_contents_parallel(ObjectStartArray* start_array,
                                   HeapWord* old_gen_bottom,
                                   HeapWord* old_gen_top,
@@ -861,6 +861,7 @@ void PSParallelCompact::summary_phase()
 
   MutableSpace* const old_space = _space_info[old_space_id].space();
   {
+    GCTraceTime(Debug, gc, phases) tm("Dense Prefix And Old Space", &_gc_timer);
     size_t total_live_words = 0;
     HeapWord* full_region_prefix_end = nullptr;
     {
@@ -904,6 +905,7 @@ void PSParallelCompact::summary_phase()
   // is the old gen.  If a space does not fit entirely into the target, then the
   // remainder is compacted into the space itself and that space becomes the new
   // target.
+  GCTraceTime(Debug, gc, phases) tm_young("Summarize Young Spaces", &_gc_timer);
   SpaceId dst_space_id = old_space_id;
   HeapWord* dst_space_end = old_space->end();
   HeapWord** new_top_addr = _space_info[dst_space_id].new_top_addr();
@@ -43,6 +43,8 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/checkedCast.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = nullptr;
@@ -50,6 +52,8 @@ PSPromotionManager::PSScannerTasksQueueSet* PSPromotionManager::_stack_array_dep
 PreservedMarksSet*             PSPromotionManager::_preserved_marks_set = nullptr;
 PSOldGen*                      PSPromotionManager::_old_gen = nullptr;
 MutableSpace*                  PSPromotionManager::_young_space = nullptr;
+size_t                         PSPromotionManager::_old_plab_size = 0;
+bool                           PSPromotionManager::_numa_bias_old_plabs = false;
 PartialArrayStateManager*      PSPromotionManager::_partial_array_state_manager = nullptr;
 
 void PSPromotionManager::initialize() {
@@ -58,6 +62,12 @@ void PSPromotionManager::initialize() {
   _old_gen = heap->old_gen();
   _young_space = heap->young_gen()->to_space();
 
+  // With NUMA the old gen pages are interleaved across the nodes. Optionally
+  // use larger old PLABs and place their pages on the node of the promoting
+  // thread instead. Large pages can not be placed at PLAB granularity.
+  _numa_bias_old_plabs = UseNUMA && !UseLargePages && PSNUMAPromotionPLABSize > 0;
+  _old_plab_size = _numa_bias_old_plabs ? MAX2(PSNUMAPromotionPLABSize, OldPLABSize) : OldPLABSize;
+
   const uint promotion_manager_num = ParallelGCThreads;
 
   assert(_partial_array_state_manager == nullptr, "Attempt to initialize twice");
@@ -106,6 +116,19 @@ PSPromotionManager* PSPromotionManager::vm_thread_promotion_manager() {
   return &_manager_array[0];
 }
 
+void PSPromotionManager::numa_bias_old_plab(HeapWord* lab_base, size_t lab_size) {
+  // Only the pages entirely within the PLAB are placed; pages shared with
+  // neighboring allocations keep their placement. Pages that have already
+  // been touched are not migrated, so this takes effect as the old gen
+  // grows into untouched memory.
+  const size_t page_size = os::vm_page_size();
+  char* const start = align_up((char*)lab_base, page_size);
+  char* const end = align_down((char*)(lab_base + lab_size), page_size);
+  if (start < end) {
+    os::numa_make_local(start, pointer_delta(end, start, sizeof(char)), os::numa_get_group_id());
+  }
+}
+
 void PSPromotionManager::pre_scavenge() {
   ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
 
@@ -66,6 +66,8 @@ class PSPromotionManager {
   static PreservedMarksSet*             _preserved_marks_set;
   static PSOldGen*                      _old_gen;
   static MutableSpace*                  _young_space;
+  static size_t                         _old_plab_size;
+  static bool                           _numa_bias_old_plabs;
 
 #if TASKQUEUE_STATS
   static void print_and_reset_taskqueue_stats();
@@ -103,6 +105,10 @@ class PSPromotionManager {
 
   void push_depth(ScannerTask task);
 
+  // Place the pages of a newly allocated old PLAB on the NUMA node of the
+  // current thread, see PSNUMAPromotionPLABSize.
+  static void numa_bias_old_plab(HeapWord* lab_base, size_t lab_size);
+
   inline void promotion_trace_event(oop new_obj, Klass* klass, size_t obj_size,
                                     uint age, bool tenured,
                                     const PSPromotionLAB* lab);
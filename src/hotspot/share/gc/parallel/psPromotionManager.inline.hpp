@@ -233,9 +233,12 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
           // Flush and fill
           _old_lab.flush();
 
-          HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+          HeapWord* lab_base = old_gen()->allocate(_old_plab_size);
           if(lab_base != nullptr) {
-            _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+            if (_numa_bias_old_plabs) {
+              numa_bias_old_plab(lab_base, _old_plab_size);
+            }
+            _old_lab.initialize(MemRegion(lab_base, _old_plab_size));
             // Try the old lab allocation again.
             new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
             promotion_trace_event(new_obj, klass, new_obj_size, age, true, &_old_lab);
@@ -650,7 +650,9 @@ void SerialFullGC::adjust_marks() {
 }
 
 void SerialFullGC::restore_marks() {
-  log_trace(gc)("Restoring %zu marks", _preserved_count + _preserved_overflow_stack_set.get()->size());
+  const size_t overflow_count = _preserved_overflow_stack_set.get()->size();
+  log_debug(gc)("Restoring %zu marks (%zu in young gen scratch, %zu in overflow stack)",
+                _preserved_count + overflow_count, _preserved_count, overflow_count);
 
   // restore the marks we saved earlier
   for (size_t i = 0; i < _preserved_count; i++) {
@@ -36,8 +36,12 @@ ClassUnloadingContext::ClassUnloadingContext(uint num_workers,
   _cld_head(nullptr),
   _num_nmethod_unlink_workers(num_workers),
   _unlinked_nmethods(nullptr),
+  _nmethods_to_free(nullptr),
+  _next_nmethod_to_free(0),
+  _purged_nmethods_size(0),
   _unregister_nmethods_during_purge(unregister_nmethods_during_purge),
-  _lock_nmethod_free_separately(lock_nmethod_free_separately) {
+  _lock_nmethod_free_separately(lock_nmethod_free_separately),
+  _installed(true) {
 
   assert(_context == nullptr, "context already set");
   _context = this;
@@ -51,13 +55,24 @@ ClassUnloadingContext::ClassUnloadingContext(uint num_workers,
 }
 
 ClassUnloadingContext::~ClassUnloadingContext() {
+  if (_nmethods_to_free != _unlinked_nmethods[0]) {
+    delete _nmethods_to_free;
+  }
   for (uint i = 0; i < _num_nmethod_unlink_workers; ++i) {
     delete _unlinked_nmethods[i];
   }
   FREE_C_HEAP_ARRAY(NMethodSet*, _unlinked_nmethods);
 
+  if (_installed) {
+    uninstall();
+  }
+}
+
+void ClassUnloadingContext::uninstall() {
+  assert(_installed, "must be");
   assert(_context == this, "context not set correctly");
   _context = nullptr;
+  _installed = false;
 }
 
 bool ClassUnloadingContext::has_unloaded_classes() const {
@@ -106,24 +121,18 @@ void ClassUnloadingContext::register_unlinked_nmethod(nmethod* nm) {
 }
 
 void ClassUnloadingContext::purge_nmethods() {
-  assert(_context != nullptr, "no context set");
-
-  size_t freed_memory = 0;
+  assert(_installed, "must be the current context");
 
   for (uint i = 0; i < _num_nmethod_unlink_workers; ++i) {
     NMethodSet* set = _unlinked_nmethods[i];
     for (nmethod* nm : *set) {
-      freed_memory += nm->size();
+      _purged_nmethods_size += nm->size();
       nm->purge(_unregister_nmethods_during_purge);
     }
   }
-
-  CodeCache::maybe_restart_compiler(freed_memory);
 }
 
-void ClassUnloadingContext::free_nmethods() {
-  assert(_context != nullptr, "no context set");
-
+void ClassUnloadingContext::prepare_free_nmethods() {
   // Sort nmethods before freeing to benefit from optimizations. If Nmethods were
   // collected in parallel, use a new temporary buffer for the result, otherwise
   // sort in-place.
@@ -156,20 +165,42 @@ void ClassUnloadingContext::free_nmethods() {
   };
   nmethod_set->sort(sort_nmethods);
 
+  _nmethods_to_free = nmethod_set;
+}
+
+void ClassUnloadingContext::free_nmethods() {
+  bool done = free_nmethods(INT_MAX);
+  assert(done, "must have freed all nmethods");
+}
+
+bool ClassUnloadingContext::free_nmethods(int max_count) {
+  if (_nmethods_to_free == nullptr) {
+    prepare_free_nmethods();
+  }
+
+  const int begin = _next_nmethod_to_free;
+  const int end = begin + MIN2(max_count, _nmethods_to_free->length() - begin);
+
   // And free. Duplicate loop for clarity depending on where we want the locking.
   if (_lock_nmethod_free_separately) {
-    for (nmethod* nm : *nmethod_set) {
+    for (int i = begin; i < end; i++) {
       MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-      CodeCache::free(nm);
+      CodeCache::free(_nmethods_to_free->at(i));
     }
   } else {
     MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    for (nmethod* nm : *nmethod_set) {
-      CodeCache::free(nm);
+    for (int i = begin; i < end; i++) {
+      CodeCache::free(_nmethods_to_free->at(i));
     }
   }
+  _next_nmethod_to_free = end;
 
-  if (is_parallel) {
-    delete nmethod_set;
+  if (end < _nmethods_to_free->length()) {
+    return false;
   }
+
+  // Only now the purged nmethods' memory is available again.
+  CodeCache::maybe_restart_compiler(_purged_nmethods_size);
+  _purged_nmethods_size = 0;
+  return true;
 }
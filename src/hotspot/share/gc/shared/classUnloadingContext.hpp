@@ -42,8 +42,18 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
   using NMethodSet = GrowableArrayCHeap<nmethod*, mtGC>;
   NMethodSet** _unlinked_nmethods;
 
+  // The unlinked nmethods sorted by address, and the index of the next one
+  // to free. Set up by the first call to free_nmethods().
+  NMethodSet* _nmethods_to_free;
+  int _next_nmethod_to_free;
+  // Code cache memory taken by the purged nmethods.
+  size_t _purged_nmethods_size;
+
   bool _unregister_nmethods_during_purge;
   bool _lock_nmethod_free_separately;
+  bool _installed;
+
+  void prepare_free_nmethods();
 
 public:
   static ClassUnloadingContext* context() { assert(_context != nullptr, "context not set"); return _context; }
@@ -61,6 +71,12 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
                         bool lock_nmethod_free_separately);
   ~ClassUnloadingContext();
 
+  // Remove this context as the current context, so that a later class
+  // unloading can set up its own context while the data of this one is
+  // still being purged. Any further use of this context must pass it
+  // explicitly.
+  void uninstall();
+
   bool has_unloaded_classes() const;
 
   void register_unloading_class_loader_data(ClassLoaderData* cld);
@@ -72,6 +88,9 @@ class ClassUnloadingContext : public CHeapObj<mtGC> {
   void register_unlinked_nmethod(nmethod* nm);
   void purge_nmethods();
   void free_nmethods();
+  // Free at most max_count of the remaining unlinked nmethods. Returns true
+  // once all of them have been freed.
+  bool free_nmethods(int max_count);
 
   void purge_and_free_nmethods() {
     purge_nmethods();
@@ -177,6 +177,17 @@
           "bigger than this")                                               \
           range(1, INT_MAX/3)                                               \
                                                                             \
+  product(uint, ParGCArrayScanChunksPerWorker, 0, EXPERIMENTAL,             \
+          "If non-zero, grow the chunk size for very large object arrays "  \
+          "so that each array is split into at most about this many "       \
+          "chunks per GC worker thread. 0 always uses chunks of "           \
+          "ParGCArrayScanChunk elements")                                   \
+          range(0, max_juint)                                               \
+                                                                            \
+  product(bool, UseNUMAAwareTaskStealing, false, EXPERIMENTAL,              \
+          "With UseNUMA, let GC worker threads first try to steal work "    \
+          "from workers on the same NUMA node before falling back to "      \
+          "stealing from any worker")                                       \
                                                                             \
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
@@ -31,7 +31,7 @@ PartialArraySplitter::PartialArraySplitter(PartialArrayStateManager* manager,
                                            uint num_workers,
                                            size_t chunk_size)
   : _allocator(manager),
-    _stepper(num_workers, chunk_size)
+    _stepper(num_workers, chunk_size, ParGCArrayScanChunksPerWorker)
     TASKQUEUE_STATS_ONLY(COMMA _stats())
 {}
 
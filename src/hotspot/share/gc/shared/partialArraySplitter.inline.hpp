@@ -65,6 +65,7 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
 #endif // TASKQUEUE_STATS
 
   // Claim a chunk and get number of additional tasks to enqueue.
+  const size_t state_length = state->length();
   PartialArrayTaskStepper::Step step = _stepper.next(state);
   // Push additional tasks.
   if (step._ncreate > 0) {
@@ -77,7 +78,7 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
   }
   // Release state, decrementing refcount, now that we're done with it.
   _allocator.release(state);
-  return Claim{step._index, step._index + _stepper.chunk_size()};
+  return Claim{step._index, step._index + _stepper.chunk_size(state_length)};
 }
 
 #endif // SHARE_GC_SHARED_PARTIALARRAYSPLITTER_INLINE_HPP
@@ -39,7 +39,10 @@ class PartialArrayState;
 // substantially expand the task queues.
 class PartialArrayTaskStepper {
 public:
-  PartialArrayTaskStepper(uint n_workers, size_t chunk_size);
+  // If max_chunks_per_worker is non-zero, arrays that would be split into
+  // more than about n_workers * max_chunks_per_worker chunks of chunk_size
+  // elements are split into that many larger chunks instead.
+  PartialArrayTaskStepper(uint n_workers, size_t chunk_size, uint max_chunks_per_worker = 0);
 
   struct Step {
     size_t _index;              // Array index for the step.
@@ -59,14 +62,21 @@ class PartialArrayTaskStepper {
   // to enqueue.
   inline Step next(PartialArrayState* state) const;
 
-  // The size of chunks to claim for each task.
+  // The minimum size of chunks to claim for each task.
   inline size_t chunk_size() const;
 
+  // The size of chunks to claim for each task for an array of the given
+  // length.  This is a function of length only, so all tasks for an array
+  // agree on it.
+  inline size_t chunk_size(size_t length) const;
+
   class TestSupport;            // For unit tests
 
 private:
   // Size (number of elements) of a chunk to process.
   size_t _chunk_size;
+  // Maximum number of chunks an array is split into, or 0 for no limit.
+  size_t _max_chunks;
   // Limit on the number of partial array tasks to create for a given array.
   uint _task_limit;
   // Maximum number of new tasks to create when processing an existing task.
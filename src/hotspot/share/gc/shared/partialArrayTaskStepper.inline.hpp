@@ -36,9 +36,22 @@ size_t PartialArrayTaskStepper::chunk_size() const {
   return _chunk_size;
 }
 
+size_t PartialArrayTaskStepper::chunk_size(size_t length) const {
+  // Very large arrays would otherwise be split into a huge number of small
+  // chunks, each costing a claim on the shared index and a queue round trip.
+  // Grow the chunk size instead, in multiples of the minimum chunk size, so
+  // there are still enough chunks per worker to balance the load.
+  if (_max_chunks == 0 || length / _chunk_size <= _max_chunks) {
+    return _chunk_size;
+  }
+  size_t multiple = (length / _chunk_size + _max_chunks - 1) / _max_chunks;
+  return _chunk_size * multiple;
+}
+
 PartialArrayTaskStepper::Step
 PartialArrayTaskStepper::start(size_t length) const {
-  size_t end = length % _chunk_size; // End of initial chunk.
+  const size_t chunk_size = this->chunk_size(length);
+  size_t end = length % chunk_size; // End of initial chunk.
   // If the initial chunk is the complete array, then don't need any partial
   // tasks.  Otherwise, start with just one partial task; see new task
   // calculation in next().
@@ -52,20 +65,21 @@ PartialArrayTaskStepper::next_impl(size_t length, volatile size_t* index_addr) c
   // Because we limit the number of enqueued tasks to being no more than the
   // number of remaining chunks to process, we can use an atomic add for the
   // claim, rather than a CAS loop.
+  const size_t chunk_size = this->chunk_size(length);
   size_t start = Atomic::fetch_then_add(index_addr,
-                                        _chunk_size,
+                                        chunk_size,
                                         memory_order_relaxed);
 
   assert(start < length, "invariant: start %zu, length %zu", start, length);
-  assert(((length - start) % _chunk_size) == 0,
+  assert(((length - start) % chunk_size) == 0,
          "invariant: start %zu, length %zu, chunk size %zu",
-         start, length, _chunk_size);
+         start, length, chunk_size);
 
   // Determine the number of new tasks to create.
   // Zero-based index for this partial task.  The initial task isn't counted.
-  uint task_num = checked_cast<uint>(start / _chunk_size);
+  uint task_num = checked_cast<uint>(start / chunk_size);
   // Number of tasks left to process, including this one.
-  uint remaining_tasks = checked_cast<uint>((length - start) / _chunk_size);
+  uint remaining_tasks = checked_cast<uint>((length - start) / chunk_size);
   assert(remaining_tasks > 0, "invariant");
   // Compute number of pending tasks, including this one.  The maximum number
   // of tasks is a function of task_num (N) and _task_fanout (F).
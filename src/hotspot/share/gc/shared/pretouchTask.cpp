@@ -29,6 +29,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/ticks.hpp"
 
 PretouchTask::PretouchTask(const char* task_name,
                            char* start_address,
@@ -74,6 +75,8 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
     return;
   }
 
+  Ticks start = Ticks::now();
+
   if (pretouch_workers != nullptr) {
     size_t num_chunks = ((total_bytes - 1) / chunk_size) + 1;
 
@@ -87,4 +90,10 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
                         task.name(), total_bytes);
     task.work(0);
   }
+
+  Ticks end = Ticks::now();
+  double elapsed_sec = (end - start).seconds();
+  log_debug(gc, heap)("%s pre-touched %zuB in %.3fms (%.1f MB/s)",
+                      task.name(), total_bytes, elapsed_sec * MILLIUNITS,
+                      elapsed_sec > 0.0 ? (total_bytes / elapsed_sec) / M : 0.0);
 }
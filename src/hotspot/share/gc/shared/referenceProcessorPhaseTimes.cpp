@@ -191,6 +191,7 @@ void ReferenceProcessorPhaseTimes::reset() {
   for (int i = 0; i < ReferenceProcessor::RefPhaseMax; i++) {
     _phases_time_ms[i] = uninitialized();
     _balance_queues_time_ms[i] = uninitialized();
+    _phase_workers[i] = 0;
   }
 
   _soft_weak_final_refs_phase_worker_time_sec->reset();
@@ -237,6 +238,16 @@ void ReferenceProcessorPhaseTimes::set_balance_queues_time_ms(ReferenceProcessor
   _balance_queues_time_ms[phase] = time_ms;
 }
 
+uint ReferenceProcessorPhaseTimes::phase_workers(ReferenceProcessor::RefProcPhases phase) const {
+  ASSERT_PHASE(phase);
+  return _phase_workers[phase];
+}
+
+void ReferenceProcessorPhaseTimes::set_phase_workers(ReferenceProcessor::RefProcPhases phase, uint num_workers) {
+  ASSERT_PHASE(phase);
+  _phase_workers[phase] = num_workers;
+}
+
 #define TIME_FORMAT "%.1lfms"
 
 void ReferenceProcessorPhaseTimes::print_all_references(uint base_indent, bool print_total) const {
@@ -302,6 +313,7 @@ void ReferenceProcessorPhaseTimes::print_phase(ReferenceProcessor::RefProcPhases
     LogStream ls(lt2);
 
     if (_processing_is_mt) {
+      print_phase_workers(&ls, phase, indent + 1);
       print_balance_time(&ls, phase, indent + 1);
     }
 
@@ -333,6 +345,13 @@ void ReferenceProcessorPhaseTimes::print_balance_time(LogStream* ls, ReferencePr
   }
 }
 
+void ReferenceProcessorPhaseTimes::print_phase_workers(LogStream* ls, ReferenceProcessor::RefProcPhases phase, uint indent) const {
+  uint num_workers = phase_workers(phase);
+  if (num_workers != 0) {
+    ls->print_cr("%s%s %u", Indents[indent], "Workers:", num_workers);
+  }
+}
+
 void ReferenceProcessorPhaseTimes::print_sub_phase(LogStream* ls, ReferenceProcessor::RefProcSubPhases sub_phase, uint indent) const {
   print_worker_time(ls, _sub_phases_worker_time_sec[sub_phase], SubPhasesSerWorkTitle[sub_phase], indent);
 }
@@ -46,6 +46,8 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   double                   _phases_time_ms[ReferenceProcessor::RefPhaseMax];
   // Records total queue balancing for each phase.
   double                   _balance_queues_time_ms[ReferenceProcessor::RefPhaseMax];
+  // Records the number of workers each phase has been run with.
+  uint                     _phase_workers[ReferenceProcessor::RefPhaseMax];
 
   WorkerDataArray<double>* _soft_weak_final_refs_phase_worker_time_sec;
 
@@ -65,10 +67,13 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
 
   double balance_queues_time_ms(ReferenceProcessor::RefProcPhases phase) const;
 
+  uint phase_workers(ReferenceProcessor::RefProcPhases phase) const;
+
   void print_reference(ReferenceType ref_type, uint base_indent) const;
 
   void print_phase(ReferenceProcessor::RefProcPhases phase, uint indent) const;
   void print_balance_time(LogStream* ls, ReferenceProcessor::RefProcPhases phase, uint indent) const;
+  void print_phase_workers(LogStream* ls, ReferenceProcessor::RefProcPhases phase, uint indent) const;
   void print_sub_phase(LogStream* ls, ReferenceProcessor::RefProcSubPhases sub_phase, uint indent) const;
   void print_worker_time(LogStream* ls, WorkerDataArray<double>* worker_time, const char* ser_title, uint indent) const;
 
@@ -88,6 +93,7 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   size_t ref_discovered(ReferenceType ref_type);
 
   void set_balance_queues_time_ms(ReferenceProcessor::RefProcPhases phase, double time_ms);
+  void set_phase_workers(ReferenceProcessor::RefProcPhases phase, uint num_workers);
 
   void set_processing_is_mt(bool processing_is_mt) { _processing_is_mt = processing_is_mt; }
 
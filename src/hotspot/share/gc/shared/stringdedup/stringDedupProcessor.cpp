@@ -40,6 +40,7 @@
 #include "runtime/cpuTimeCounters.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -104,7 +105,11 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 
 void StringDedup::Processor::yield() const {
   assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+  // Yield is called for every processed request, so only pay for the
+  // thread state transitions if a safepoint or handshake is pending.
+  if (SafepointMechanism::should_process(_thread)) {
+    ThreadBlockInVM tbivm(_thread);
+  }
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
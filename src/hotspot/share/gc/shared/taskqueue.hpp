@@ -47,6 +47,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_remote,     // subset of successful steals from a queue on another NUMA node
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -68,6 +69,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_remote_steal() { ++_stats[steal_remote]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -390,10 +392,19 @@ class GenericTaskQueue: public TaskQueueSuper<N, MT> {
 
   int _seed; // Current random seed used for selecting a random queue during stealing.
 
-  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int));
+  static const int InvalidNUMAId = -1;
+  // NUMA node of the owner thread, recorded when it starts stealing. Read
+  // racily by other thieves of the set, so only ever used as a hint.
+  volatile int _numa_id;
+
+  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int) + sizeof(int));
 public:
   int next_random_queue_id();
 
+  void set_numa_id(int id)                   { Atomic::store(&_numa_id, id); }
+  int numa_id() const                        { return Atomic::load(&_numa_id); }
+  bool is_numa_id_valid() const              { return numa_id() != InvalidNUMAId; }
+
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
@@ -471,6 +482,11 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // Variant of steal_best_of_2() that only samples queues whose owners are
+  // known to run on the same NUMA node as the owner of queue_num. Returns
+  // Empty without attempting a steal if no such queue has been found.
+  PopResult steal_best_of_2_local(uint queue_num, E& t);
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -27,13 +27,16 @@
 
 #include "gc/shared/taskqueue.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -100,7 +103,8 @@ template<class E, MemTag MT, unsigned int N>
 inline GenericTaskQueue<E, MT, N>::GenericTaskQueue() :
   _elems(MallocArrayAllocator<E>::allocate(N, MT)),
   _last_stolen_queue_id(InvalidQueueId),
-  _seed(17 /* random number */) {}
+  _seed(17 /* random number */),
+  _numa_id(InvalidNUMAId) {}
 
 template<class E, MemTag MT, unsigned int N>
 inline GenericTaskQueue<E, MT, N>::~GenericTaskQueue() {
@@ -353,6 +357,11 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      TASKQUEUE_STATS_ONLY(
+        if (local_queue->is_numa_id_valid() && queue(sel_k)->numa_id() != local_queue->numa_id()) {
+          local_queue->stats.record_remote_steal();
+        }
+      )
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -371,13 +380,65 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
   }
 }
 
+template<class T, MemTag MT>
+typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal_best_of_2_local(uint queue_num, E& t) {
+  T* const local_queue = queue(queue_num);
+  const int numa_id = local_queue->numa_id();
+  assert(local_queue->is_numa_id_valid(), "must have been recorded");
+
+  // Draw a bounded number of random candidates and keep the first two that
+  // live on our node. Owners that have not started stealing yet have no
+  // recorded node and are skipped; the caller falls back to remote steals.
+  const uint max_draws = 4;
+  uint k1 = queue_num;
+  uint k2 = queue_num;
+  for (uint i = 0; i < max_draws && k2 == queue_num; i++) {
+    uint k = local_queue->next_random_queue_id() % _n;
+    if (k == queue_num || k == k1 || queue(k)->numa_id() != numa_id) {
+      continue;
+    }
+    if (k1 == queue_num) {
+      k1 = k;
+    } else {
+      k2 = k;
+    }
+  }
+  if (k1 == queue_num) {
+    return PopResult::Empty;
+  }
+
+  uint sel_k = k1;
+  if (k2 != queue_num && queue(k2)->size() > queue(k1)->size()) {
+    sel_k = k2;
+  }
+  if (queue(sel_k)->size() == 0) {
+    return PopResult::Empty;
+  }
+  PopResult suc = queue(sel_k)->pop_global(t);
+  TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(suc);)
+  if (suc == PopResult::Success) {
+    local_queue->set_last_stolen_queue_id(sel_k);
+  }
+  return suc;
+}
+
 template<class T, MemTag MT>
 bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  // With NUMA-aware stealing, spend the first half of the attempts on
+  // victims on our own node, where the stolen task and the objects it
+  // refers to are more likely to be local.
+  uint num_local_retries = 0;
+  if (UseNUMAAwareTaskStealing && UseNUMA && _n > 2) {
+    queue(queue_num)->set_numa_id(os::numa_get_group_id());
+    num_local_retries = _n;
+  }
+
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
-    PopResult sr = steal_best_of_2(queue_num, t);
+    PopResult sr = (i < num_local_retries) ? steal_best_of_2_local(queue_num, t)
+                                           : steal_best_of_2(queue_num, t);
     if (sr == PopResult::Success) {
       return true;
     } else if (sr == PopResult::Contended) {
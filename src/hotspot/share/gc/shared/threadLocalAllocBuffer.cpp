@@ -26,12 +26,15 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/copy.hpp"
@@ -160,6 +163,16 @@ void ThreadLocalAllocBuffer::resize() {
                       p2i(thread()), thread()->osthread()->thread_id(),
                       _target_refills, _allocation_fraction.average(), desired_size(), aligned_new_size);
 
+  EventTLABResize event;
+  if (event.should_commit()) {
+    event.set_thread(JFR_JVM_THREAD_ID(thread()));
+    event.set_allocationFraction((float)_allocation_fraction.average());
+    event.set_targetRefills(_target_refills);
+    event.set_previousSize(desired_size() * HeapWordSize);
+    event.set_newSize(aligned_new_size * HeapWordSize);
+    event.commit();
+  }
+
   set_desired_size(aligned_new_size);
   set_refill_waste_limit(initial_refill_waste_limit());
 }
@@ -182,6 +195,8 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
 
   initialize(start, top, start + new_size - alignment_reserve());
 
+  print_numa_placement();
+
   // Reset amount of internal fragmentation
   set_refill_waste_limit(initial_refill_waste_limit());
 }
@@ -305,6 +320,23 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _refill_waste * HeapWordSize);
 }
 
+void ThreadLocalAllocBuffer::print_numa_placement() {
+  // Looking up the node backing an address is a system call, so only
+  // sample when explicitly asked for.
+  if (!UseNUMA || !log_is_enabled(Trace, gc, tlab, numa)) {
+    return;
+  }
+
+  Thread* thrd = thread();
+  int tlab_node = os::numa_get_group_id_for_address(start());
+  int cpu_node = os::numa_get_group_id();
+  log_trace(gc, tlab, numa)("TLAB NUMA: thread: " PTR_FORMAT " [id: %2d]"
+                            " tlab node: %d cpu node: %d%s",
+                            p2i(thrd), thrd->osthread()->thread_id(),
+                            tlab_node, cpu_node,
+                            (tlab_node != -1 && tlab_node != cpu_node) ? " (remote)" : "");
+}
+
 Thread* ThreadLocalAllocBuffer::thread() {
   return (Thread*)(((char*)this) + in_bytes(start_offset()) - in_bytes(Thread::tlab_start_offset()));
 }
@@ -95,6 +95,7 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
   void print_stats(const char* tag);
+  void print_numa_placement();
 
   Thread* thread();
 
@@ -303,6 +303,21 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
     return true;
   }
 
+  if (ShenandoahAdaptiveForecastAllocationRate && _allocation_rate.trend() > 0.0) {
+    double forecast = _allocation_rate.forecast_allocation(avg_cycle_time);
+    if (forecast > allocation_headroom) {
+      double trend = _allocation_rate.trend();
+      log_trigger("Forecast allocation (%.0f %sB) during average GC time (%.2f ms) is above free headroom (%zu%s)"
+                   " (allocation rate trend = %.0f %sB/s per second)",
+                   byte_size_in_proper_unit(forecast), proper_unit_for_byte_size(forecast),
+                   avg_cycle_time * 1000,
+                   byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
+                   byte_size_in_proper_unit(trend), proper_unit_for_byte_size(trend));
+      accept_trigger_with_type(FORECAST);
+      return true;
+    }
+  }
+
   bool is_spiking = _allocation_rate.is_spiking(rate, _spike_threshold_sd);
   if (is_spiking && avg_cycle_time > allocation_headroom / rate) {
     log_trigger("Average GC time (%.2f ms) is above the time for instantaneous allocation rate (%.0f %sB/s) to deplete free headroom (%zu%s) (spike threshold = %.2f)",
@@ -325,6 +340,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
 void ShenandoahAdaptiveHeuristics::adjust_last_trigger_parameters(double amount) {
   switch (_last_trigger) {
     case RATE:
+    case FORECAST:
       adjust_margin_of_error(amount);
       break;
     case SPIKE:
@@ -357,7 +373,10 @@ ShenandoahAllocationRate::ShenandoahAllocationRate() :
   _last_sample_value(0),
   _interval_sec(1.0 / ShenandoahAdaptiveSampleFrequencyHz),
   _rate(int(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz), ShenandoahAdaptiveDecayFactor),
-  _rate_avg(int(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz), ShenandoahAdaptiveDecayFactor) {
+  _rate_avg(int(ShenandoahAdaptiveSampleSizeSeconds * ShenandoahAdaptiveSampleFrequencyHz), ShenandoahAdaptiveDecayFactor),
+  _has_level(false),
+  _level(0.0),
+  _trend(0.0) {
 }
 
 double ShenandoahAllocationRate::sample(size_t allocated) {
@@ -368,6 +387,7 @@ double ShenandoahAllocationRate::sample(size_t allocated) {
       rate = instantaneous_rate(now, allocated);
       _rate.add(rate);
       _rate_avg.add(_rate.avg());
+      update_trend(now - _last_sample_time, rate);
     }
 
     _last_sample_time = now;
@@ -384,6 +404,28 @@ double ShenandoahAllocationRate::upper_bound(double sds) const {
   return _rate.davg() + (sds * _rate_avg.dsd());
 }
 
+void ShenandoahAllocationRate::update_trend(double time_delta_sec, double rate) {
+  if (!_has_level) {
+    _level = rate;
+    _trend = 0.0;
+    _has_level = true;
+    return;
+  }
+
+  const double alpha = ShenandoahAdaptiveDecayFactor;
+  const double beta = ShenandoahAdaptiveTrendDecayFactor;
+  const double last_level = _level;
+  _level = alpha * rate + (1.0 - alpha) * (_level + _trend * time_delta_sec);
+  _trend = beta * ((_level - last_level) / time_delta_sec) + (1.0 - beta) * _trend;
+}
+
+double ShenandoahAllocationRate::forecast_allocation(double horizon_sec) const {
+  // Integral of level + trend * t over [0, horizon_sec]. A falling trend
+  // must not forecast negative allocation.
+  double forecast = _level * horizon_sec + 0.5 * _trend * horizon_sec * horizon_sec;
+  return MAX2(forecast, 0.0);
+}
+
 void ShenandoahAllocationRate::allocation_counter_reset() {
   _last_sample_time = os::elapsedTime();
   _last_sample_value = 0;
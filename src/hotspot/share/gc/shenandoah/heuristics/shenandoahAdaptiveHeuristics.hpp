@@ -41,8 +41,15 @@ class ShenandoahAllocationRate : public CHeapObj<mtGC> {
 
   double upper_bound(double sds) const;
   bool is_spiking(double rate, double threshold) const;
+
+  // Bytes expected to be allocated over the next horizon_sec seconds if
+  // the allocation rate keeps changing along its current trend.
+  double forecast_allocation(double horizon_sec) const;
+  double trend() const { return _trend; }
  private:
 
+  void update_trend(double time_delta_sec, double rate);
+
   double instantaneous_rate(double time, size_t allocated) const;
 
   double _last_sample_time;
@@ -50,6 +57,12 @@ class ShenandoahAllocationRate : public CHeapObj<mtGC> {
   double _interval_sec;
   TruncatedSeq _rate;
   TruncatedSeq _rate_avg;
+
+  // Double exponentially smoothed (Holt) level and trend of the
+  // allocation rate. The trend is in bytes/s per second.
+  bool _has_level;
+  double _level;
+  double _trend;
 };
 
 /*
@@ -104,7 +117,7 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
   // error for the average cycle time and allocation rate or the allocation
   // spike detection threshold.
   enum Trigger {
-    SPIKE, RATE, OTHER
+    SPIKE, RATE, FORECAST, OTHER
   };
 
   void adjust_last_trigger_parameters(double amount);
@@ -58,6 +58,16 @@ ShenandoahAgeCensus::ShenandoahAgeCensus() {
   } else {
     _local_age_table = nullptr;
   }
+  if (ShenandoahGenerationalAdaptiveTenuring && !ShenandoahGenerationalCensusAtEvac &&
+      is_sampling() && ShenandoahGenerationalCensusVerifySampling) {
+    size_t max_workers = ShenandoahHeap::heap()->max_workers();
+    _local_verify_age_table = NEW_C_HEAP_ARRAY(AgeTable*, max_workers, mtGC);
+    for (uint i = 0; i < max_workers; i++) {
+      _local_verify_age_table[i] = new AgeTable(false);
+    }
+  } else {
+    _local_verify_age_table = nullptr;
+  }
   _epoch = MAX_SNAPSHOTS - 1;  // see update_epoch()
 }
 
@@ -93,6 +103,14 @@ NO_CENSUS_NOISE(void ShenandoahAgeCensus::add(uint obj_age, uint region_age, siz
   }
 }
 
+void ShenandoahAgeCensus::add_for_verification(uint obj_age, uint region_age, size_t size, uint worker_id) {
+  assert(_local_verify_age_table != nullptr, "Only when verifying sampled census");
+  if (obj_age <= markWord::max_age) {
+    const uint age = MIN2(obj_age + region_age, (uint)(MAX_COHORTS - 1));  // clamp
+    _local_verify_age_table[worker_id]->add(age, size);
+  }
+}
+
 #ifdef SHENANDOAH_CENSUS_NOISE
 void ShenandoahAgeCensus::add_skipped(size_t size, uint worker_id) {
   _local_noise[worker_id].skipped += size;
@@ -144,6 +162,9 @@ void ShenandoahAgeCensus::update_census(size_t age0_pop, AgeTable* pv1, AgeTable
       CENSUS_NOISE(_global_noise[_epoch].merge(_local_noise[i]);)
       CENSUS_NOISE(_local_noise[i].clear();)
     }
+    if (_local_verify_age_table != nullptr) {
+      verify_sampled_census(age0_pop);
+    }
   } else {
     // census during evac
     assert(pv1 != nullptr && pv2 != nullptr, "Error, check caller");
@@ -159,6 +180,27 @@ void ShenandoahAgeCensus::update_census(size_t age0_pop, AgeTable* pv1, AgeTable
 }
 
 
+void ShenandoahAgeCensus::verify_sampled_census(size_t age0_pop) {
+  AgeTable full(false);
+  full.add((uint)0, age0_pop);
+  size_t max_workers = ShenandoahHeap::heap()->max_workers();
+  for (uint i = 0; i < max_workers; i++) {
+    full.merge(_local_verify_age_table[i]);
+    _local_verify_age_table[i]->clear();
+  }
+
+  const AgeTable* sampled = _global_age_table[_epoch];
+  for (uint i = 0; i < MAX_COHORTS; i++) {
+    const size_t sampled_pop = sampled->sizes[i];
+    const size_t full_pop = full.sizes[i];
+    if (sampled_pop + full_pop > 0) {
+      const double error = full_pop > 0 ? ((double)sampled_pop - (double)full_pop) / (double)full_pop : 1.0;
+      log_info(gc, age)("Sampled census - age %3u: sampled %10zu bytes, full %10zu bytes, error %6.2f%%",
+                        i, sampled_pop * oopSize, full_pop * oopSize, error * 100);
+    }
+  }
+}
+
 // Reset the epoch for the global age tables,
 // clearing all history.
 void ShenandoahAgeCensus::reset_global() {
@@ -181,6 +223,9 @@ void ShenandoahAgeCensus::reset_local() {
   for (uint i = 0; i < max_workers; i++) {
     _local_age_table[i]->clear();
     CENSUS_NOISE(_local_noise[i].clear();)
+    if (_local_verify_age_table != nullptr) {
+      _local_verify_age_table[i]->clear();
+    }
   }
 }
 
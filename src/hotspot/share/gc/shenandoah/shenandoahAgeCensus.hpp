@@ -26,6 +26,9 @@
 #define SHARE_GC_SHENANDOAH_SHENANDOAHAGECENSUS_HPP
 
 #include "gc/shared/ageTable.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
 
 #ifndef PRODUCT
 // Enable noise instrumentation
@@ -97,6 +100,7 @@ struct ShenandoahNoiseStats {
 class ShenandoahAgeCensus: public CHeapObj<mtGC> {
   AgeTable** _global_age_table;      // Global age table used for adapting tenuring threshold, one per snapshot
   AgeTable** _local_age_table;       // Local scratch age tables to track object ages, one per worker
+  AgeTable** _local_verify_age_table; // Local full census age tables when verifying sampling, one per worker
 
 #ifdef SHENANDOAH_CENSUS_NOISE
   ShenandoahNoiseStats* _global_noise; // Noise stats, one per snapshot
@@ -144,6 +148,10 @@ class ShenandoahAgeCensus: public CHeapObj<mtGC> {
     return _tenuring_threshold[prev];
   }
 
+  // Log the difference between the sampled census for the current epoch, and
+  // the full census in the local verification tables, clearing the latter.
+  void verify_sampled_census(size_t age0_pop);
+
 #ifndef PRODUCT
   // Return the sum of size of objects of all ages recorded in the
   // census at snapshot indexed by snap.
@@ -188,6 +196,31 @@ class ShenandoahAgeCensus: public CHeapObj<mtGC> {
   void add_young(size_t size, uint worker_id);
 #endif // SHENANDOAH_CENSUS_NOISE
 
+  // Whether the census is sampled, see ShenandoahGenerationalCensusSampleRate
+  static bool is_sampling() {
+    return ShenandoahGenerationalCensusSampleRate > 1;
+  }
+
+  // Whether obj is counted in a sampled census. The selection hashes the
+  // address, so that objects allocated together (and so typically of the
+  // same age) are not all selected or all skipped together.
+  static bool is_sampled(oop obj) {
+    if (!is_sampling()) {
+      return true;
+    }
+    const uint32_t hash = (uint32_t)(cast_from_oop<uintptr_t>(obj) >> LogMinObjAlignmentInBytes) * 2654435761u;
+    return (hash >> 16) % ShenandoahGenerationalCensusSampleRate == 0;
+  }
+
+  // Size to add to the census for an object of size that was sampled
+  static size_t sampled_size(size_t size) {
+    return size * ShenandoahGenerationalCensusSampleRate;
+  }
+
+  // Update the local full census table for worker_id by size, used to verify a
+  // sampled census (ShenandoahGenerationalCensusVerifySampling)
+  void add_for_verification(uint obj_age, uint region_age, size_t size, uint worker_id);
+
   // Update the census data, and compute the new tenuring threshold.
   // This method should be called at the end of each marking (or optionally
   // evacuation) cycle to update the tenuring threshold to be used in
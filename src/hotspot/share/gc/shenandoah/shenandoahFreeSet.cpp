@@ -33,10 +33,14 @@
 #include "gc/shenandoah/shenandoahOldGeneration.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.inline.hpp"
+#include "gc/shenandoah/shenandoahUtils.hpp"
 #include "gc/shenandoah/shenandoahYoungGeneration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/init.hpp"
 #include "runtime/orderAccess.hpp"
+#include "utilities/align.hpp"
 
 static const char* partition_name(ShenandoahFreeSetPartitionId t) {
   switch (t) {
@@ -1391,53 +1395,131 @@ void ShenandoahFreeSet::clear_internal() {
   _partitions.set_bias_from_left_to_right(ShenandoahFreeSetPartitionId::OldCollector, false);
 }
 
-void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
-                                                         size_t &first_old_region, size_t &last_old_region,
-                                                         size_t &old_region_count) {
-  clear_internal();
+// Interval bounds and totals of one partition, as found by find_regions_with_alloc_capacity()
+class ShenandoahFreeSetPartitionTallies {
+public:
+  size_t _leftmost;
+  size_t _rightmost;
+  size_t _leftmost_empty;
+  size_t _rightmost_empty;
+  size_t _regions;
+  size_t _used;
+
+  explicit ShenandoahFreeSetPartitionTallies(size_t max_regions) :
+    _leftmost(max_regions),
+    _rightmost(0),
+    _leftmost_empty(max_regions),
+    _rightmost_empty(0),
+    _regions(0),
+    _used(0) {}
+
+  void add(size_t idx, bool is_empty, size_t used) {
+    _leftmost = MIN2(_leftmost, idx);
+    _rightmost = MAX2(_rightmost, idx);
+    if (is_empty) {
+      _leftmost_empty = MIN2(_leftmost_empty, idx);
+      _rightmost_empty = MAX2(_rightmost_empty, idx);
+    }
+    _regions++;
+    _used += used;
+  }
 
-  first_old_region = _heap->num_regions();
-  last_old_region = 0;
-  old_region_count = 0;
-  old_cset_regions = 0;
-  young_cset_regions = 0;
+  void merge(const ShenandoahFreeSetPartitionTallies& other) {
+    _leftmost = MIN2(_leftmost, other._leftmost);
+    _rightmost = MAX2(_rightmost, other._rightmost);
+    _leftmost_empty = MIN2(_leftmost_empty, other._leftmost_empty);
+    _rightmost_empty = MAX2(_rightmost_empty, other._rightmost_empty);
+    _regions += other._regions;
+    _used += other._used;
+  }
+};
 
-  size_t region_size_bytes = _partitions.region_size_bytes();
-  size_t max_regions = _partitions.max_regions();
+class ShenandoahFreeSetRegionTallies {
+public:
+  size_t _young_cset_regions;
+  size_t _old_cset_regions;
+  size_t _first_old_region;
+  size_t _last_old_region;
+  size_t _old_region_count;
+  ShenandoahFreeSetPartitionTallies _mutator;
+  ShenandoahFreeSetPartitionTallies _old_collector;
+
+  ShenandoahFreeSetRegionTallies(size_t num_regions, size_t max_regions) :
+    _young_cset_regions(0),
+    _old_cset_regions(0),
+    _first_old_region(num_regions),
+    _last_old_region(0),
+    _old_region_count(0),
+    _mutator(max_regions),
+    _old_collector(max_regions) {}
+
+  void merge(const ShenandoahFreeSetRegionTallies& other) {
+    _young_cset_regions += other._young_cset_regions;
+    _old_cset_regions += other._old_cset_regions;
+    _first_old_region = MIN2(_first_old_region, other._first_old_region);
+    _last_old_region = MAX2(_last_old_region, other._last_old_region);
+    _old_region_count += other._old_region_count;
+    _mutator.merge(other._mutator);
+    _old_collector.merge(other._old_collector);
+  }
+};
 
-  size_t mutator_leftmost = max_regions;
-  size_t mutator_rightmost = 0;
-  size_t mutator_leftmost_empty = max_regions;
-  size_t mutator_rightmost_empty = 0;
-  size_t mutator_regions = 0;
-  size_t mutator_used = 0;
+class ShenandoahFindRegionsWithAllocCapacityTask : public WorkerTask {
+private:
+  ShenandoahFreeSet* const _free_set;
+  ShenandoahFreeSetRegionTallies* const _tallies;
+  const size_t _num_regions;
+  const size_t _stride;
 
-  size_t old_collector_leftmost = max_regions;
-  size_t old_collector_rightmost = 0;
-  size_t old_collector_leftmost_empty = max_regions;
-  size_t old_collector_rightmost_empty = 0;
-  size_t old_collector_regions = 0;
-  size_t old_collector_used = 0;
+  shenandoah_padding(0);
+  volatile size_t _index;
+  shenandoah_padding(1);
 
-  size_t num_regions = _heap->num_regions();
-  for (size_t idx = 0; idx < num_regions; idx++) {
+public:
+  ShenandoahFindRegionsWithAllocCapacityTask(ShenandoahFreeSet* free_set, ShenandoahFreeSetRegionTallies* tallies,
+                                             size_t num_regions, size_t stride) :
+    WorkerTask("Shenandoah Find Regions With Alloc Capacity"),
+    _free_set(free_set),
+    _tallies(tallies),
+    _num_regions(num_regions),
+    _stride(stride),
+    _index(0) {}
+
+  void work(uint worker_id) {
+    ShenandoahParallelWorkerSession worker_session(worker_id);
+    ShenandoahFreeSetRegionTallies& tallies = _tallies[worker_id];
+    while (true) {
+      const size_t start = Atomic::fetch_then_add(&_index, _stride, memory_order_relaxed);
+      if (start >= _num_regions) {
+        break;
+      }
+      const size_t end = MIN2(start + _stride, _num_regions);
+      _free_set->find_regions_with_alloc_capacity(start, end, tallies);
+    }
+  }
+};
+
+void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t start, size_t end,
+                                                         ShenandoahFreeSetRegionTallies& tallies) {
+  size_t region_size_bytes = _partitions.region_size_bytes();
+  for (size_t idx = start; idx < end; idx++) {
     ShenandoahHeapRegion* region = _heap->get_region(idx);
     if (region->is_trash()) {
       // Trashed regions represent regions that had been in the collection partition but have not yet been "cleaned up".
       // The cset regions are not "trashed" until we have finished update refs.
       if (region->is_old()) {
-        old_cset_regions++;
+        tallies._old_cset_regions++;
       } else {
         assert(region->is_young(), "Trashed region should be old or young");
-        young_cset_regions++;
+        tallies._young_cset_regions++;
       }
     } else if (region->is_old()) {
       // count both humongous and regular regions, but don't count trash (cset) regions.
-      old_region_count++;
-      if (first_old_region > idx) {
-        first_old_region = idx;
+      tallies._old_region_count++;
+      if (tallies._first_old_region > idx) {
+        tallies._first_old_region = idx;
       }
-      last_old_region = idx;
+      tallies._last_old_region = idx;
     }
     if (region->is_alloc_allowed() || region->is_trash()) {
       assert(!region->is_cset(), "Shouldn't be adding cset regions to the free set");
@@ -1448,45 +1530,67 @@ void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regi
         if (region->is_trash() || !region->is_old()) {
           // Both young and old collected regions (trashed) are placed into the Mutator set
           _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::Mutator);
-          if (idx < mutator_leftmost) {
-            mutator_leftmost = idx;
-          }
-          if (idx > mutator_rightmost) {
-            mutator_rightmost = idx;
-          }
-          if (ac == region_size_bytes) {
-            if (idx < mutator_leftmost_empty) {
-              mutator_leftmost_empty = idx;
-            }
-            if (idx > mutator_rightmost_empty) {
-              mutator_rightmost_empty = idx;
-            }
-          }
-          mutator_regions++;
-          mutator_used += (region_size_bytes - ac);
+          tallies._mutator.add(idx, ac == region_size_bytes, region_size_bytes - ac);
         } else {
           // !region->is_trash() && region is_old()
           _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::OldCollector);
-          if (idx < old_collector_leftmost) {
-            old_collector_leftmost = idx;
-          }
-          if (idx > old_collector_rightmost) {
-            old_collector_rightmost = idx;
-          }
-          if (ac == region_size_bytes) {
-            if (idx < old_collector_leftmost_empty) {
-              old_collector_leftmost_empty = idx;
-            }
-            if (idx > old_collector_rightmost_empty) {
-              old_collector_rightmost_empty = idx;
-            }
-          }
-          old_collector_regions++;
-          old_collector_used += (region_size_bytes - ac);
+          tallies._old_collector.add(idx, ac == region_size_bytes, region_size_bytes - ac);
         }
       }
     }
   }
+}
+
+void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
+                                                         size_t &first_old_region, size_t &last_old_region,
+                                                         size_t &old_region_count) {
+  clear_internal();
+
+  size_t max_regions = _partitions.max_regions();
+  size_t num_regions = _heap->num_regions();
+  ShenandoahFreeSetRegionTallies tallies(num_regions, max_regions);
+
+  // Classifying the regions is independent per region, and dominates the rebuild on heaps with many regions.
+  // Split it across the workers in strides that are a multiple of the membership bitmap word, so that no two
+  // workers ever update the same bitmap word.
+  const uint active_workers = _heap->workers()->active_workers();
+  constexpr size_t threshold = 4096;
+  if (is_init_completed() && active_workers > 1 && num_regions > threshold) {
+    const size_t stride = align_up(MAX2(num_regions / (active_workers * 4), (size_t)BitsPerWord), (size_t)BitsPerWord);
+    ShenandoahFreeSetRegionTallies* worker_tallies = NEW_C_HEAP_ARRAY(ShenandoahFreeSetRegionTallies, active_workers, mtGC);
+    for (uint i = 0; i < active_workers; i++) {
+      ::new (&worker_tallies[i]) ShenandoahFreeSetRegionTallies(num_regions, max_regions);
+    }
+    ShenandoahFindRegionsWithAllocCapacityTask task(this, worker_tallies, num_regions, stride);
+    _heap->workers()->run_task(&task);
+    for (uint i = 0; i < active_workers; i++) {
+      tallies.merge(worker_tallies[i]);
+    }
+    FREE_C_HEAP_ARRAY(ShenandoahFreeSetRegionTallies, worker_tallies);
+  } else {
+    find_regions_with_alloc_capacity(0, num_regions, tallies);
+  }
+
+  young_cset_regions = tallies._young_cset_regions;
+  old_cset_regions = tallies._old_cset_regions;
+  first_old_region = tallies._first_old_region;
+  last_old_region = tallies._last_old_region;
+  old_region_count = tallies._old_region_count;
+
+  size_t mutator_leftmost = tallies._mutator._leftmost;
+  size_t mutator_rightmost = tallies._mutator._rightmost;
+  size_t mutator_leftmost_empty = tallies._mutator._leftmost_empty;
+  size_t mutator_rightmost_empty = tallies._mutator._rightmost_empty;
+  size_t mutator_regions = tallies._mutator._regions;
+  size_t mutator_used = tallies._mutator._used;
+
+  size_t old_collector_leftmost = tallies._old_collector._leftmost;
+  size_t old_collector_rightmost = tallies._old_collector._rightmost;
+  size_t old_collector_leftmost_empty = tallies._old_collector._leftmost_empty;
+  size_t old_collector_rightmost_empty = tallies._old_collector._rightmost_empty;
+  size_t old_collector_regions = tallies._old_collector._regions;
+  size_t old_collector_used = tallies._old_collector._used;
+
   log_debug(gc, free)("  At end of prep_to_rebuild, mutator_leftmost: %zu"
                       ", mutator_rightmost: %zu"
                       ", mutator_leftmost_empty: %zu"
@@ -311,7 +311,11 @@ class ShenandoahRegionPartitions {
 //     sure there is enough memory reserved at the high end of memory to hold the objects that might need to be evacuated
 //     during the next GC pass.
 
+class ShenandoahFreeSetRegionTallies;
+
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahFindRegionsWithAllocCapacityTask;
+
 private:
   ShenandoahHeap* const _heap;
   ShenandoahRegionPartitions _partitions;
@@ -536,6 +540,11 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   void find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
                                         size_t &first_old_region, size_t &last_old_region, size_t &old_region_count);
 
+  // Classify regions [start, end) and add them to their partition's membership. Interval bounds and totals are
+  // accumulated into tallies rather than into _partitions, so that disjoint ranges can be processed in parallel.
+  // Ranges processed in parallel must start on a ShenandoahSimpleBitMap word boundary.
+  void find_regions_with_alloc_capacity(size_t start, size_t end, ShenandoahFreeSetRegionTallies& tallies);
+
   // Ensure that Collector has at least to_reserve bytes of available memory, and OldCollector has at least old_reserve
   // bytes of available memory.  On input, old_region_count holds the number of regions already present in the
   // OldCollector partition.  Upon return, old_region_count holds the updated number of regions in the OldCollector partition.
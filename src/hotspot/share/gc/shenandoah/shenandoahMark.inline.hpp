@@ -120,10 +120,20 @@ inline void ShenandoahMark::count_liveness(ShenandoahLiveData* live_data, oop ob
     assert(heap->mode()->is_generational(), "Only if generational");
     if (ShenandoahGenerationalAdaptiveTenuring && !ShenandoahGenerationalCensusAtEvac) {
       assert(region->is_young(), "Only for young objects");
-      uint age = ShenandoahHeap::get_object_age(obj);
-      ShenandoahAgeCensus* const census = ShenandoahGenerationalHeap::heap()->age_census();
-      CENSUS_NOISE(census->add(age, region->age(), region->youth(), size, worker_id);)
-      NO_CENSUS_NOISE(census->add(age, region->age(), size, worker_id);)
+      const bool sampled = ShenandoahAgeCensus::is_sampled(obj);
+      const bool verify = ShenandoahAgeCensus::is_sampling() && ShenandoahGenerationalCensusVerifySampling;
+      if (sampled || verify) {
+        uint age = ShenandoahHeap::get_object_age(obj);
+        ShenandoahAgeCensus* const census = ShenandoahGenerationalHeap::heap()->age_census();
+        if (sampled) {
+          const size_t census_size = ShenandoahAgeCensus::sampled_size(size);
+          CENSUS_NOISE(census->add(age, region->age(), region->youth(), census_size, worker_id);)
+          NO_CENSUS_NOISE(census->add(age, region->age(), census_size, worker_id);)
+        }
+        if (verify) {
+          census->add_for_verification(age, region->age(), size, worker_id);
+        }
+      }
     }
   }
 
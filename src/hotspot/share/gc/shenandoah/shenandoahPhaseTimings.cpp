@@ -239,6 +239,7 @@ void ShenandoahPhaseTimings::print_cycle_on(outputStream* out) const {
   out->cr();
   out->print_cr("All times are wall-clock times, except per-root-class counters, that are sum over");
   out->print_cr("all workers. Dividing the <total> over the root stage time estimates parallelism.");
+  out->print_cr("Imbalance is the slowest worker time over the average worker time.");
   out->cr();
   for (uint i = 0; i < _num_phases; i++) {
     double v = _cycle_data[i] * 1000000.0;
@@ -254,14 +255,23 @@ void ShenandoahPhaseTimings::print_cycle_on(outputStream* out) const {
 
       if (_worker_data[i] != nullptr) {
         out->print(", workers (us): ");
+        double max_tv = 0.0;
+        double sum_tv = 0.0;
+        uint num_tv = 0;
         for (uint c = 0; c < _max_workers; c++) {
           double tv = _worker_data[i]->get(c);
           if (tv != ShenandoahWorkerData::uninitialized()) {
             out->print(SHENANDOAH_US_WORKER_TIME_FORMAT ", ", tv * 1000000.0);
+            max_tv = MAX2(max_tv, tv);
+            sum_tv += tv;
+            num_tv++;
           } else {
             out->print(SHENANDOAH_US_WORKER_NOTIME_FORMAT ", ", "---");
           }
         }
+        if (num_tv > 1 && sum_tv > 0) {
+          out->print("imbalance: " SHENANDOAH_PARALLELISM_FORMAT "x", max_tv / (sum_tv / num_tv));
+        }
       }
       out->cr();
     }
@@ -77,6 +77,16 @@
   product(bool, ShenandoahGenerationalAdaptiveTenuring, true, EXPERIMENTAL, \
           "(Generational mode only) Dynamically adapt tenuring age.")       \
                                                                             \
+  product(uintx, ShenandoahGenerationalCensusSampleRate, 1, EXPERIMENTAL,   \
+          "(Generational mode only) Count only about one in this many "     \
+          "objects in the age census during marking, and scale their "      \
+          "sizes accordingly. 1 counts every object.")                      \
+          range(1,1024)                                                     \
+                                                                            \
+  product(bool, ShenandoahGenerationalCensusVerifySampling, false, DIAGNOSTIC,\
+          "(Generational mode only) When the age census is sampled, "       \
+          "also take a full census and log the difference per cohort.")     \
+                                                                            \
   product(bool, ShenandoahGenerationalCensusIgnoreOlderCohorts, true,       \
                                                                EXPERIMENTAL,\
           "(Generational mode only) Ignore mortality rates older than the " \
@@ -251,6 +261,19 @@
           "Larger values give more weight to recent values.")               \
           range(0,1.0)                                                      \
                                                                             \
+  product(bool, ShenandoahAdaptiveForecastAllocationRate, false, EXPERIMENTAL,\
+          "Also track the trend of the allocation rate, and start a "       \
+          "cycle if the rate extrapolated along that trend would "          \
+          "deplete the free headroom before an average cycle completes. "   \
+          "This starts cycles earlier when the allocation rate is "         \
+          "ramping up.")                                                    \
+                                                                            \
+  product(double, ShenandoahAdaptiveTrendDecayFactor, 0.3, EXPERIMENTAL,    \
+          "The decay factor (beta) used for the trend of the allocation "   \
+          "rate when ShenandoahAdaptiveForecastAllocationRate is "          \
+          "enabled. Larger values react faster to a change in trend.")      \
+          range(0,1.0)                                                      \
+                                                                            \
   product(uintx, ShenandoahGuaranteedGCInterval, 5*60*1000, EXPERIMENTAL,   \
           "Many heuristics would guarantee a concurrent GC cycle at "       \
           "least with this interval. This is useful when large idle "       \
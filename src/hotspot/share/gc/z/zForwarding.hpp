@@ -61,6 +61,7 @@ class ZForwarding {
   ZPage* const           _page;
   const ZPageAge         _from_age;
   const ZPageAge         _to_age;
+  const uint32_t         _numa_id;
   volatile bool          _claimed;
   mutable ZConditionLock _ref_lock;
   volatile int32_t       _ref_count;
@@ -97,12 +98,16 @@ class ZForwarding {
   ZForwarding(ZPage* page, ZPageAge to_age, size_t nentries);
 
 public:
+  // NUMA id of pages that span several partitions
+  static const uint32_t MultiPartitionNUMAId = UINT32_MAX;
+
   static uint32_t nentries(const ZPage* page);
   static ZForwarding* alloc(ZForwardingAllocator* allocator, ZPage* page, ZPageAge to_age);
 
   ZPageType type() const;
   ZPageAge from_age() const;
   ZPageAge to_age() const;
+  uint32_t numa_id() const;
   zoffset start() const;
   zoffset_end end() const;
   size_t size() const;
@@ -63,6 +63,7 @@ inline ZForwarding::ZForwarding(ZPage* page, ZPageAge to_age, size_t nentries)
     _page(page),
     _from_age(page->age()),
     _to_age(to_age),
+    _numa_id(page->is_multi_partition() ? MultiPartitionNUMAId : page->single_partition_id()),
     _claimed(false),
     _ref_lock(),
     _ref_count(1),
@@ -86,6 +87,10 @@ inline ZPageAge ZForwarding::to_age() const {
   return _to_age;
 }
 
+inline uint32_t ZForwarding::numa_id() const {
+  return _numa_id;
+}
+
 inline zoffset ZForwarding::start() const {
   return _virtual.start();
 }
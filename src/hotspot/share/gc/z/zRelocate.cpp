@@ -33,6 +33,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -50,6 +51,7 @@
 #include "utilities/debug.hpp"
 
 static const ZStatCriticalPhase ZCriticalPhaseRelocationStall("Relocation Stall");
+static const ZStatCounter ZCounterBarrierRelocation("Memory", "Barrier Relocation", ZStatUnitBytesPerSecond);
 static const ZStatSubPhase ZSubPhaseConcurrentRelocateRememberedSetFlipPromotedYoung("Concurrent Relocate Remset FP", ZGenerationId::young);
 
 ZRelocateQueue::ZRelocateQueue()
@@ -344,6 +346,11 @@ static zaddress relocate_object_inner(ZForwarding* forwarding, zaddress from_add
   if (to_addr_final != to_addr) {
     // Already relocated, try undo allocation
     allocator->undo_alloc_object(to_addr, size);
+  } else {
+    // Objects relocated through the barrier have just been accessed and end up
+    // in the shared relocation pages, apart from the objects relocated by the
+    // worker threads in their own target pages.
+    ZStatInc(ZCounterBarrierRelocation, size);
   }
 
   return to_addr_final;
@@ -1057,6 +1064,7 @@ class ZRelocateStoreBufferInstallBasePointersTask : public ZTask {
 class ZRelocateTask : public ZRestartableTask {
 private:
   ZRelocationSetParallelIterator _iter;
+  ZRelocationSetNUMAIterator     _numa_iter;
   ZGeneration* const             _generation;
   ZRelocateQueue* const          _queue;
   ZRelocateSmallAllocator        _small_allocator;
@@ -1066,6 +1074,7 @@ class ZRelocateTask : public ZRestartableTask {
   ZRelocateTask(ZRelocationSet* relocation_set, ZRelocateQueue* queue)
     : ZRestartableTask("ZRelocateTask"),
       _iter(relocation_set),
+      _numa_iter(relocation_set),
       _generation(relocation_set->generation()),
       _queue(queue),
       _small_allocator(_generation),
@@ -1106,9 +1115,21 @@ class ZRelocateTask : public ZRestartableTask {
       }
     };
 
+    // Relocate pages local to the node this worker runs on first, so that
+    // both the reads from the page and the writes to the target page, which
+    // is allocated on the local node, stay local. Then help with the
+    // remaining pages of all nodes.
+    const bool numa_local_first = ZNUMA::is_enabled();
+    const uint32_t numa_id = numa_local_first ? ZNUMA::id() : 0;
+
     const auto do_forwarding_one_from_iter = [&]() {
       ZForwarding* forwarding;
 
+      if (numa_local_first && _numa_iter.next(numa_id, &forwarding)) {
+        claim_and_do_forwarding(forwarding);
+        return true;
+      }
+
       if (_iter.next(&forwarding)) {
         claim_and_do_forwarding(forwarding);
         return true;
@@ -26,6 +26,7 @@
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -204,3 +205,34 @@ void ZRelocationSet::register_in_place_relocate_promoted(ZPage* page) {
   assert(!_in_place_relocate_promoted_pages.contains(page), "no duplicates allowed");
   _in_place_relocate_promoted_pages.append(page);
 }
+
+ZRelocationSetNUMAIterator::ZRelocationSetNUMAIterator(ZRelocationSet* relocation_set)
+  : _forwardings(relocation_set->_forwardings),
+    _nforwardings(relocation_set->_nforwardings),
+    _next(NEW_C_HEAP_ARRAY(size_t, ZNUMA::count(), mtGC)) {
+  for (uint32_t i = 0; i < ZNUMA::count(); i++) {
+    _next[i] = 0;
+  }
+}
+
+ZRelocationSetNUMAIterator::~ZRelocationSetNUMAIterator() {
+  FREE_C_HEAP_ARRAY(size_t, _next);
+}
+
+bool ZRelocationSetNUMAIterator::next(uint32_t numa_id, ZForwarding** forwarding) {
+  for (;;) {
+    const size_t index = Atomic::fetch_then_add(&_next[numa_id], (size_t)1);
+    if (index >= _nforwardings) {
+      return false;
+    }
+
+    // Only the cached NUMA id may be read here. The page of a forwarding
+    // that is skipped may already have been relocated and released by a
+    // worker on another node.
+    ZForwarding* const candidate = _forwardings[index];
+    if (candidate->numa_id() == numa_id) {
+      *forwarding = candidate;
+      return true;
+    }
+  }
+}
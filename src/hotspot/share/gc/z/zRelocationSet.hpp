@@ -37,6 +37,7 @@ class ZWorkers;
 
 class ZRelocationSet {
   template <bool> friend class ZRelocationSetIteratorImpl;
+  friend class ZRelocationSetNUMAIterator;
 
 private:
   ZGeneration*         _generation;
@@ -70,4 +71,21 @@ class ZRelocationSetIteratorImpl : public ZArrayIteratorImpl<ZForwarding*, Paral
 using ZRelocationSetIterator = ZRelocationSetIteratorImpl<false /* Parallel */>;
 using ZRelocationSetParallelIterator = ZRelocationSetIteratorImpl<true /* Parallel */>;
 
+// Parallel iterator over the forwardings whose pages are located on a given
+// NUMA node. Each node has its own cursor, so that worker threads can first
+// relocate the pages local to the node they run on. Pages spanning multiple
+// nodes are never returned.
+class ZRelocationSetNUMAIterator : public StackObj {
+private:
+  ZForwarding** const _forwardings;
+  const size_t        _nforwardings;
+  volatile size_t*    _next;
+
+public:
+  ZRelocationSetNUMAIterator(ZRelocationSet* relocation_set);
+  ~ZRelocationSetNUMAIterator();
+
+  bool next(uint32_t numa_id, ZForwarding** forwarding);
+};
+
 #endif // SHARE_GC_Z_ZRELOCATIONSET_HPP
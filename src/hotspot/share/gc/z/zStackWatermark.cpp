@@ -25,6 +25,7 @@
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zStackWatermark.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zStoreBarrierBuffer.hpp"
 #include "gc/z/zThreadLocalAllocBuffer.hpp"
 #include "gc/z/zThreadLocalData.hpp"
@@ -35,6 +36,11 @@
 #include "runtime/stackWatermark.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/preserveException.hpp"
+#include "utilities/ticks.hpp"
+
+static const ZStatSampler ZSamplerStackWatermarkStart("Stack", "Watermark Start Processing", ZStatUnitTime);
+static const ZStatCounter ZCounterStackFramesMutator("Stack", "Frames Processed By Mutators", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterStackFramesGC("Stack", "Frames Processed By GC", ZStatUnitOpsPerSecond);
 
 ZOnStackNMethodClosure::ZOnStackNMethodClosure()
   : _bs_nm(BarrierSet::barrier_set()->barrier_set_nmethod()) {}
@@ -174,6 +180,8 @@ void ZStackWatermark::process_head(void* context) {
 }
 
 void ZStackWatermark::start_processing_impl(void* context) {
+  const Ticks start = Ticks::now();
+
   save_old_watermark();
 
   // Process the non-frame part of the thread
@@ -201,6 +209,8 @@ void ZStackWatermark::start_processing_impl(void* context) {
 
   // Publishes the processing start to concurrent threads
   StackWatermark::start_processing_impl(context);
+
+  ZStatSample(ZSamplerStackWatermarkStart, (Ticks::now() - start).value());
 }
 
 void ZStackWatermark::process(const frame& fr, RegisterMap& register_map, void* context) {
@@ -209,4 +219,13 @@ void ZStackWatermark::process(const frame& fr, RegisterMap& register_map, void*
   ZOnStackNMethodClosure nm_cl;
 
   fr.oops_do(&cl, &nm_cl, &register_map, DerivedPointerIterationMode::_directly);
+
+  // Frames processed by the thread itself, or by another mutator walking
+  // its stack, are a direct cost on the application. Frames processed by
+  // GC workers are not.
+  if (Thread::current()->is_Java_thread()) {
+    ZStatInc(ZCounterStackFramesMutator);
+  } else {
+    ZStatInc(ZCounterStackFramesGC);
+  }
 }
@@ -25,6 +25,8 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zStoreBarrierBuffer.inline.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -275,10 +277,29 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
+  // Mark all previous values first, and then add the remembered set entries
+  // for the whole buffer. The stored fields are often located on the same
+  // page, so looking up the page only when the field is not on the page
+  // of the previous entry avoids most of the page table lookups.
   for (size_t i = current(); i < BufferLength; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
+  }
+
+  ZPage* page = nullptr;
+  for (size_t i = current(); i < BufferLength; ++i) {
+    volatile zpointer* const p = _buffer[i]._p;
+    const zaddress p_addr = to_zaddress((uintptr_t)p);
+    if (page == nullptr || !page->is_in(p_addr)) {
+      page = ZHeap::heap()->page(p);
+    }
+    if (page->is_old()) {
+      // Only need remset entries for old objects
+      page->remember(p);
+    }
   }
 
   clear();
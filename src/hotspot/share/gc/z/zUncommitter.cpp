@@ -40,6 +40,9 @@
 
 static const ZStatCounter ZCounterUncommit("Memory", "Uncommit", ZStatUnitBytesPerSecond);
 
+// Interval in milliseconds for checking the memory pressure while waiting.
+static const uint64_t ZUncommitPressurePollInterval = 1000;
+
 ZUncommitter::ZUncommitter(uint32_t id, ZPartition* partition)
   : _id(id),
     _partition(partition),
@@ -79,9 +82,21 @@ bool ZUncommitter::wait(uint64_t timeout) const {
       }
 
       // Wait
-      _lock.wait(remaining_timeout_ms);
+      if (ZUncommitPressurePercent > 0) {
+        _lock.wait(MIN2(remaining_timeout_ms, ZUncommitPressurePollInterval));
+      } else {
+        _lock.wait(remaining_timeout_ms);
+      }
 
       now = os::elapsedTime();
+
+      if (is_memory_pressure() && now < wait_until) {
+        // Return memory to the system as soon as possible. Having waited at
+        // least one poll interval limits the rate of uncommit cycles.
+        log_debug(gc, heap)("Uncommitter (%u) Memory Pressure: " UINT64_FORMAT "ms timeout skipped",
+                            _id, to_millis(wait_until - now));
+        break;
+      }
     } while (!_stop && now < wait_until);
   }
 
@@ -93,6 +108,18 @@ bool ZUncommitter::should_continue() const {
   return !_stop;
 }
 
+bool ZUncommitter::is_memory_pressure() const {
+  if (ZUncommitPressurePercent == 0) {
+    return false;
+  }
+
+  // Both values take the limits of the container into account, if any.
+  const julong available = os::available_memory();
+  const julong physical = os::physical_memory();
+
+  return available < physical / 100 * ZUncommitPressurePercent;
+}
+
 void ZUncommitter::update_statistics(size_t uncommitted, Ticks start, Tickspan* accumulated_time) const {
   // Update counter
   ZStatInc(ZCounterUncommit, uncommitted);
@@ -317,6 +344,12 @@ void ZUncommitter::register_uncommit(size_t size) {
     return;
   }
 
+  if (is_memory_pressure()) {
+    // Under memory pressure, work as fast as we can.
+    _next_uncommit_timeout = 0;
+    return;
+  }
+
   const double uncommit_rate = double(_uncommitted) / time_since_start;
   const double time_to_complete = double(_to_uncommit) / uncommit_rate;
   const double time_left = double(ZUncommitDelay) - time_since_start;
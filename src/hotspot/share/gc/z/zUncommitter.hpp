@@ -46,6 +46,8 @@ class ZUncommitter : public ZThread {
   bool wait(uint64_t timeout) const;
   bool should_continue() const;
 
+  bool is_memory_pressure() const;
+
   uint64_t to_millis(double seconds) const;
 
   void update_next_cycle_timeout(double from_time);
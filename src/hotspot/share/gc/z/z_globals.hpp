@@ -55,6 +55,19 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(uint, ZUncommitPressurePercent, 0, EXPERIMENTAL,                  \
+          "Uncommit unused memory without waiting for ZUncommitDelay "      \
+          "when the available memory, including container limits, "         \
+          "drops below this percentage of the physical memory "             \
+          "(0 means disabled)")                                             \
+          range(0, 100)                                                     \
+                                                                            \
+  product(bool, ZCollapseTransparentHugePages, false, EXPERIMENTAL,         \
+          "Synchronously collapse newly committed heap memory into "        \
+          "transparent huge pages, instead of waiting for khugepaged "      \
+          "to do it. Only has an effect on Linux when transparent huge "    \
+          "pages are used for the heap")                                    \
+                                                                            \
   product(double, ZYoungCompactionLimit, 25.0,                              \
           "Maximum allowed garbage in young pages")                         \
           range(0, 100)                                                     \
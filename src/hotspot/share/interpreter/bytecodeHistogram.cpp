@@ -165,8 +165,8 @@ void BytecodePairHistogram::print(float cutoff) {
   tty->cr();   //0123456789012345678901234567890123456789012345678901234567890123456789
   tty->print_cr("Histogram of %d executed bytecode pairs:", tot);
   tty->cr();
-  tty->print_cr("  absolute  relative    codes    1st bytecode        2nd bytecode");
-  tty->print_cr("----------------------------------------------------------------------");
+  tty->print_cr("  absolute  relative  cumulative    codes    1st bytecode        2nd bytecode");
+  tty->print_cr("----------------------------------------------------------------------------------");
   int i = profile->length();
   while (i-- > 0) {
     HistoEntry* e = profile->at(i);
@@ -175,11 +175,12 @@ void BytecodePairHistogram::print(float cutoff) {
     if (cutoff <= rel) {
       int   c1 = e->index() % number_of_codes;
       int   c2 = e->index() / number_of_codes;
-      tty->print_cr("%10d   %6.3f%%    %02x %02x    %-19s %s", abs, rel, c1, c2, name_for(c1), name_for(c2));
       abs_sum += abs;
+      float cum = (float)abs_sum * 100.0F / (float)tot;
+      tty->print_cr("%10d   %6.3f%%    %6.3f%%    %02x %02x    %-19s %s", abs, rel, cum, c1, c2, name_for(c1), name_for(c2));
     }
   }
-  tty->print_cr("----------------------------------------------------------------------");
+  tty->print_cr("----------------------------------------------------------------------------------");
   float rel_sum = (float)abs_sum * 100.0F / (float)tot;
   tty->print_cr("%10d   %6.3f%%    (cutoff = %.3f%%)", abs_sum, rel_sum, cutoff);
   tty->cr();
@@ -429,10 +429,16 @@ void InterpreterOopMap::copy_from(const OopMapCacheEntry* src) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
-  return   ((unsigned int) bci)
-         ^ ((unsigned int) method->max_locals()         << 2)
-         ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+  // The Method* itself does not move, so its address is mixed in as well to
+  // tell apart methods with the same shape.
+  unsigned int hash = ((unsigned int) bci)
+                    ^ ((unsigned int) method->max_locals()         << 2)
+                    ^ ((unsigned int) method->code_size()          << 4)
+                    ^ ((unsigned int) method->size_of_parameters() << 6)
+                    ^ ((unsigned int) (p2i(method()) >> LogBytesPerWord));
+  // Only the low bits select a slot in the small table, so spread the
+  // higher bits into them (Fibonacci hashing).
+  return (hash * 2654435761u) >> 16;
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
@@ -44,6 +44,7 @@
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -111,9 +112,11 @@ void PathToGcRootsOperation::doit() {
   BFSClosure bfs(&edge_queue, _edge_store, &mark_bits);
   RootSetClosure<BFSClosure> roots(&bfs);
 
+  const jlong start_nanos = os::javaTimeNanos();
   GranularTimer::start(_cutoff_ticks, 1000000);
   roots.process();
-  if (edge_queue.is_full() || _skip_bfs) {
+  const bool use_dfs = edge_queue.is_full() || _skip_bfs;
+  if (use_dfs) {
     // Pathological case where roots don't fit in queue
     // Do a depth-first search, but mark roots first
     // to avoid walking sideways over roots
@@ -122,6 +125,9 @@ void PathToGcRootsOperation::doit() {
     bfs.process();
   }
   GranularTimer::stop();
+  log_debug(jfr, system)("Path to GC roots search (%s) took %.3f ms",
+                         use_dfs ? "depth-first" : "breadth-first",
+                         (double)(os::javaTimeNanos() - start_nanos) / NANOSECS_PER_MILLISEC);
   log_edge_queue_summary(edge_queue);
 
   // Emit old objects including their reference chains as events
@@ -33,6 +33,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 
 //
 // Entry point for "JFR Recorder Thread" message loop.
@@ -77,7 +78,13 @@ void recorderthread_entry(JavaThread* thread, JavaThread* unused) {
         if (START) {
           service.start();
         } else if (ROTATE) {
+          const bool log_cpu_time = log_is_enabled(Debug, jfr, system) && os::is_thread_cpu_time_supported();
+          const jlong cpu_start = log_cpu_time ? os::current_thread_cpu_time() : 0;
           service.rotate(msgs);
+          if (log_cpu_time) {
+            log_debug(jfr, system)("Chunk rotation took %.3f ms of recorder thread CPU time",
+                                   (double)(os::current_thread_cpu_time() - cpu_start) / NANOSECS_PER_MILLISEC);
+          }
         } else if (FLUSHPOINT) {
           service.flushpoint();
         }
@@ -92,6 +99,10 @@ void recorderthread_entry(JavaThread* thread, JavaThread* unused) {
   } // JfrMsg_lock scope and the thread returns to _thread_in_vm
 
   assert(!JfrMsg_lock->owned_by_self(), "invariant");
+  if (log_is_enabled(Debug, jfr, system) && os::is_thread_cpu_time_supported()) {
+    log_debug(jfr, system)("Recorder thread used %.3f ms CPU time",
+                           (double)os::current_thread_cpu_time() / NANOSECS_PER_MILLISEC);
+  }
   JfrRecorder::on_recorder_thread_exit();
 
   #undef START
@@ -111,7 +111,7 @@ void JfrStackTrace::write(JfrCheckpointWriter& cpw) const {
 }
 
 bool JfrStackTrace::equals(const JfrStackTrace& rhs) const {
-  if (_reached_root != rhs._reached_root || _frames->length() != rhs.number_of_frames() || _hash != rhs._hash) {
+  if (_hash != rhs._hash || _reached_root != rhs._reached_root || _frames->length() != rhs.number_of_frames()) {
     return false;
   }
   for (int i = 0; i < _frames->length(); ++i) {
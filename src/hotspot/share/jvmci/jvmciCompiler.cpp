@@ -190,13 +190,13 @@ void JVMCICompiler::on_empty_queue(CompileQueue* queue, CompilerThread* thread)
 }
 
 // Print compilation timers
-void JVMCICompiler::print_timers() {
-  tty->print_cr("    JVMCI CompileBroker Time:");
-  tty->print_cr("       Compile:        %7.3f s", stats()->total_time());
-  _jit_code_installs.print_on(tty, "       Install Code:   ");
-  tty->cr();
-  tty->print_cr("    JVMCI Hosted Time:");
-  _hosted_code_installs.print_on(tty, "       Install Code:   ");
+void JVMCICompiler::print_timers(outputStream* st) {
+  st->print_cr("    JVMCI CompileBroker Time:");
+  st->print_cr("       Compile:        %7.3f s", stats()->total_time());
+  _jit_code_installs.print_on(st, "       Install Code:   ");
+  st->cr();
+  st->print_cr("    JVMCI Hosted Time:");
+  _hosted_code_installs.print_on(st, "       Install Code:   ");
 }
 
 bool JVMCICompiler::is_intrinsic_supported(const methodHandle& method) {
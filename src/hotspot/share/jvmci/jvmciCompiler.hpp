@@ -134,7 +134,7 @@ class JVMCICompiler : public AbstractCompiler {
   virtual void on_empty_queue(CompileQueue* queue, CompilerThread* thread);
 
   // Print compilation timers and statistics
-  virtual void print_timers();
+  virtual void print_timers(outputStream* st);
 
   virtual bool is_intrinsic_supported(const methodHandle& method);
 
@@ -112,8 +112,12 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   {
     ConsumerLocker clocker;
     if (_buffer->push_back(output, decorations, msg, msg_len)) {
-      _data_available = true;
-      clocker.notify();
+      // The consumer only waits while no data is available, so only the
+      // first message after a buffer swap needs to wake it up.
+      if (!_data_available) {
+        _data_available = true;
+        clocker.notify();
+      }
       return;
     }
 
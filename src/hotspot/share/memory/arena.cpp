@@ -42,10 +42,6 @@
 // been created so we cannot use Mutex.
 static PlatformMutex* GlobalChunkPoolMutex = nullptr;
 
-void Arena::initialize_chunk_pool() {
-  GlobalChunkPoolMutex = new PlatformMutex();
-}
-
 ChunkPoolLocker::ChunkPoolLocker() {
   assert(GlobalChunkPoolMutex != nullptr, "must be initialized");
   GlobalChunkPoolMutex->lock();
@@ -83,36 +79,69 @@ class ChunkPool {
 
   Chunk*       _first;
   const size_t _size;         // (inner payload) size of the chunks this pool serves
+  size_t       _num_chunks;   // number of chunks in the pool
+  size_t       _low_water;    // lowest _num_chunks since the last prune
+
+  // Each pool has its own lock for its free list, so threads using chunks of
+  // different sizes do not contend. GlobalChunkPoolMutex is still taken when
+  // chunks are actually freed, to keep NMT adjustment stable.
+  PlatformMutex* _lock;
+
+  class PoolLocker : public StackObj {
+    PlatformMutex* const _lock;
+   public:
+    PoolLocker(ChunkPool* pool) : _lock(pool->_lock) { _lock->lock(); }
+    ~PoolLocker() { _lock->unlock(); }
+  };
 
   // Returns null if pool is empty.
   Chunk* take_from_pool() {
-    ChunkPoolLocker lock;
+    PoolLocker lock(this);
     Chunk* c = _first;
     if (_first != nullptr) {
       _first = _first->next();
+      _num_chunks--;
+      _low_water = MIN2(_low_water, _num_chunks);
     }
     return c;
   }
   void return_to_pool(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
-    ChunkPoolLocker lock;
+    PoolLocker lock(this);
     chunk->set_next(_first);
     _first = chunk;
+    _num_chunks++;
   }
 
-  // Clear this pool of all contained chunks
+  // Free the chunks that stayed unused since the last prune. The pool is
+  // LIFO, so those are the _low_water chunks at the tail of the list. Chunks
+  // that were recycled in the meantime, e.g. by back-to-back compilations,
+  // are kept, so steady-state users do not malloc and free them over and over.
   void prune() {
-    // Free all chunks with ChunkPoolLocker lock
+    // Free chunks with ChunkPoolLocker lock
     // so NMT adjustment is stable.
     ChunkPoolLocker lock;
+    PoolLocker pool_lock(this);
+    assert(_low_water <= _num_chunks, "sanity");
+    size_t keep = _num_chunks - _low_water;
     Chunk* cur = _first;
-    Chunk* next = nullptr;
+    if (keep == 0) {
+      _first = nullptr;
+    } else {
+      Chunk* last_kept = _first;
+      for (size_t i = 1; i < keep; i++) {
+        last_kept = last_kept->next();
+      }
+      cur = last_kept->next();
+      last_kept->set_next(nullptr);
+    }
     while (cur != nullptr) {
-      next = cur->next();
+      Chunk* next = cur->next();
       os::free(cur);
       cur = next;
     }
-    _first = nullptr;
+    _num_chunks = keep;
+    _low_water = keep;
   }
 
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
@@ -126,7 +155,13 @@ class ChunkPool {
   }
 
 public:
-  ChunkPool(size_t size) : _first(nullptr), _size(size) {}
+  ChunkPool(size_t size) : _first(nullptr), _size(size), _num_chunks(0), _low_water(0), _lock(nullptr) {}
+
+  static void initialize() {
+    for (int i = 0; i < _num_pools; i++) {
+      _pools[i]._lock = new PlatformMutex();
+    }
+  }
 
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
@@ -224,6 +259,11 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
 
 ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
 
+void Arena::initialize_chunk_pool() {
+  GlobalChunkPoolMutex = new PlatformMutex();
+  ChunkPool::initialize();
+}
+
 class ChunkPoolCleaner : public PeriodicTask {
   static const int cleaning_interval = 5000; // cleaning interval in ms
 
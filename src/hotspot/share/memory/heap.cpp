@@ -533,6 +533,17 @@ size_t CodeHeap::heap_unallocated_capacity() const {
   return segments_to_size(_number_of_reserved_segments - _next_segment);
 }
 
+// Returns the size of the largest contiguous free space: either the biggest
+// free list entry or the not yet allocated tail of the heap. Comparing this
+// with unallocated_capacity() shows how fragmented the heap is.
+size_t CodeHeap::largest_free_block() const {
+  size_t largest = _number_of_reserved_segments - _next_segment;
+  for (FreeBlock* b = _freelist; b != nullptr; b = b->link()) {
+    largest = MAX2(largest, b->length());
+  }
+  return segments_to_size(largest);
+}
+
 // Free list management
 
 FreeBlock* CodeHeap::following_block(FreeBlock *b) {
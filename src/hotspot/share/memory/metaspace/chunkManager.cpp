@@ -372,6 +372,17 @@ void ChunkManager::purge() {
       ls.cr();
     }
   }
+
+  // What is left committed in free chunks sits in chunks smaller than a commit
+  //  granule, which cannot be uncommitted without also uncommitting their in-use
+  //  neighbors. This is the part of committed metaspace lost to fragmentation.
+  LogTarget(Debug, metaspace) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print(LOGFMT ": free chunks still committed: %d chunks, ", LOGFMT_ARGS, _chunks.calc_num_committed_chunks());
+    print_scaled_words_and_percentage(&ls, _chunks.calc_committed_word_size(), committed_after);
+    ls.print_cr(" of committed");
+  }
   SOMETIMES(_vslist->verify_locked();)
   SOMETIMES(verify_locked();)
 }
@@ -39,6 +39,16 @@ size_t FreeChunkList::calc_committed_word_size() const {
   return s;
 }
 
+int FreeChunkList::calc_num_committed_chunks() const {
+  int n = 0;
+  for (const Metachunk* c = _first; c != nullptr; c = c->next()) {
+    if (c->committed_words() > 0) {
+      n++;
+    }
+  }
+  return n;
+}
+
 void FreeChunkList::print_on(outputStream* st) const {
   if (_num_chunks.get() > 0) {
     for (const Metachunk* c = _first; c != nullptr; c = c->next()) {
@@ -107,6 +117,14 @@ size_t FreeChunkListVector::calc_committed_word_size_at_level(chunklevel_t lvl)
   return list_for_level(lvl)->calc_committed_word_size();
 }
 
+int FreeChunkListVector::calc_num_committed_chunks() const {
+  int n = 0;
+  for (chunklevel_t l = chunklevel::LOWEST_CHUNK_LEVEL; l <= chunklevel::HIGHEST_CHUNK_LEVEL; l++) {
+    n += list_for_level(l)->calc_num_committed_chunks();
+  }
+  return n;
+}
+
 // Returns total committed size in all lists
 int FreeChunkListVector::num_chunks() const {
   int n = 0;
@@ -178,6 +178,9 @@ class FreeChunkList {
   // Calculates total number of committed words over all chunks (walks chunks).
   size_t calc_committed_word_size() const;
 
+  // Calculates number of chunks with committed words (walks chunks).
+  int calc_num_committed_chunks() const;
+
   void print_on(outputStream* st) const;
 
 };
@@ -240,6 +243,9 @@ class FreeChunkListVector {
   // Calculates total number of committed words over all chunks (walks chunks).
   size_t calc_committed_word_size() const;
 
+  // Calculates number of chunks with committed words in all lists (walks chunks).
+  int calc_num_committed_chunks() const;
+
   // Returns number of chunks in all lists
   int num_chunks() const;
 
@@ -101,8 +101,10 @@ class MemoryCounter {
  * Malloc memory used by a particular subsystem.
  * It includes the memory acquired through os::malloc()
  * call and arena's backing memory.
+ * Cache line aligned, so that threads allocating with different memory
+ * tags do not contend on the same line.
  */
-class MallocMemory {
+class ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE) MallocMemory {
  private:
   MemoryCounter _malloc;
   MemoryCounter _arena;
@@ -150,7 +152,8 @@ class MallocMemorySnapshot {
 
  private:
   MallocMemory      _malloc[mt_number_of_tags];
-  MemoryCounter     _all_mallocs;
+  // Updated on every malloc and free; keep it off the per-tag lines
+  ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE) MemoryCounter _all_mallocs;
 
 
  public:
@@ -37,6 +37,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/debug.hpp"
@@ -49,6 +50,9 @@
 #endif
 
 NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
+uint MemTracker::_malloc_stack_sample_rate = 1;
+THREAD_LOCAL int MemTracker::_malloc_stack_sample_countdown = 0;
+THREAD_LOCAL uint MemTracker::_malloc_stack_sample_seed = 0;
 
 DeferredStatic<MemBaseline> MemTracker::_baseline;
 
@@ -83,6 +87,10 @@ void MemTracker::initialize() {
     }
   }
 
+  if (level == NMT_detail) {
+    _malloc_stack_sample_rate = NMTMallocStackSampleRate;
+  }
+
   NMTPreInit::pre_to_post(level == NMT_off);
 
   _tracking_level = level;
@@ -95,7 +103,21 @@ void MemTracker::initialize() {
     ls.print_cr("Preinit state: ");
     NMTPreInit::print_state(&ls);
     MallocLimitHandler::print_on(&ls);
+    if (_malloc_stack_sample_rate > 1) {
+      ls.print_cr("Sampling malloc call stacks: 1 in %u", _malloc_stack_sample_rate);
+    }
+  }
+}
+
+// Re-arm the countdown with a pseudo-random value in [1, 2 * rate - 1], so
+// that on average one in rate mallocs records its stack. A fixed stride would
+// lock step with periodic allocation patterns and never sample some sites.
+void MemTracker::rearm_malloc_stack_sample_countdown() {
+  if (_malloc_stack_sample_seed == 0) {
+    _malloc_stack_sample_seed = (uint)os::random() | 1;
   }
+  _malloc_stack_sample_seed = (uint)os::next_random(_malloc_stack_sample_seed);
+  _malloc_stack_sample_countdown = 1 + (int)(_malloc_stack_sample_seed % (2 * _malloc_stack_sample_rate - 1));
 }
 
 // Report during error reporting.
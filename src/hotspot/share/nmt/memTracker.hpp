@@ -42,6 +42,13 @@
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
 
+// Like CALLER_PC, but for malloc-heavy paths: with NMTMallocStackSampleRate > 1
+// only every n-th allocation of a thread walks the stack, the others are
+// accounted to the empty call stack site.
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail &&  \
+                           MemTracker::sample_malloc_stack()) ?             \
+                          NativeCallStack(1) : FAKE_CALLSTACK)
+
 class MemTracker : AllStatic {
   friend class VirtualMemoryTrackerTest;
 
@@ -76,6 +83,19 @@ class MemTracker : AllStatic {
     return _tracking_level > NMT_off;
   }
 
+  // Returns true if the current malloc should record its call stack. Only
+  // consulted in detail mode.
+  static inline bool sample_malloc_stack() {
+    if (_malloc_stack_sample_rate <= 1) {
+      return true;
+    }
+    if (--_malloc_stack_sample_countdown > 0) {
+      return false;
+    }
+    rearm_malloc_stack_sample_countdown();
+    return true;
+  }
+
   // Per-malloc overhead incurred by NMT, depending on the current NMT level
   static size_t overhead_per_malloc() {
     return enabled() ? MallocTracker::overhead_per_malloc() : 0;
@@ -318,6 +338,12 @@ class MemTracker : AllStatic {
  private:
   // Tracking level
   static NMT_TrackingLevel   _tracking_level;
+  // Copy of NMTMallocStackSampleRate, the per-thread countdown to the next
+  // sampled malloc stack, and the per-thread seed it is re-armed from
+  static uint                _malloc_stack_sample_rate;
+  static THREAD_LOCAL int    _malloc_stack_sample_countdown;
+  static THREAD_LOCAL uint   _malloc_stack_sample_seed;
+  static void rearm_malloc_stack_sample_countdown();
   // Stored baseline
   static DeferredStatic<MemBaseline> _baseline;
 };
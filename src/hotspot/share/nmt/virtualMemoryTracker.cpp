@@ -84,12 +84,12 @@ void VirtualMemoryTracker::set_reserved_region_tag(address addr, size_t size, Me
     apply_summary_diff(diff);
 }
 
-void VirtualMemoryTracker::Instance::apply_summary_diff(VMATree::SummaryDiff diff) {
+void VirtualMemoryTracker::Instance::apply_summary_diff(const VMATree::SummaryDiff& diff) {
   assert(_tracker != nullptr, "Sanity check");
   _tracker->apply_summary_diff(diff);
 }
 
-void VirtualMemoryTracker::apply_summary_diff(VMATree::SummaryDiff diff) {
+void VirtualMemoryTracker::apply_summary_diff(const VMATree::SummaryDiff& diff) {
   VMATree::SingleDiff::delta reserve_delta, commit_delta;
   size_t reserved, committed;
   MemTag tag = mtNone;
@@ -107,6 +107,10 @@ void VirtualMemoryTracker::apply_summary_diff(VMATree::SummaryDiff diff) {
   for (int i = 0; i < mt_number_of_tags; i++) {
     reserve_delta = diff.tag[i].reserve;
     commit_delta = diff.tag[i].commit;
+    if (reserve_delta == 0 && commit_delta == 0) {
+      // Most operations only touch one or two tags
+      continue;
+    }
     tag = NMTUtil::index_to_tag(i);
     reserved = VirtualMemorySummary::as_snapshot()->by_tag(tag)->reserved();
     committed = VirtualMemorySummary::as_snapshot()->by_tag(tag)->committed();
@@ -381,7 +381,7 @@ class VirtualMemoryTracker {
 
   // Snapshot current thread stacks
   void snapshot_thread_stacks();
-  void apply_summary_diff(VMATree::SummaryDiff diff);
+  void apply_summary_diff(const VMATree::SummaryDiff& diff);
   RegionsTree* tree() { return &_tree; }
 
   class Instance : public AllStatic {
@@ -403,7 +403,7 @@ class VirtualMemoryTracker {
     static bool walk_virtual_memory(VirtualMemoryWalker* walker);
     static bool print_containing_region(const void* p, outputStream* st);
     static void snapshot_thread_stacks();
-    static void apply_summary_diff(VMATree::SummaryDiff diff);
+    static void apply_summary_diff(const VMATree::SummaryDiff& diff);
 
     static RegionsTree* tree() { return _tracker->tree(); }
   };
@@ -646,6 +646,13 @@ void Method::build_profiling_method_data(const methodHandle& method, TRAPS) {
     return;
   }
 
+  // Threads running the same hot method tend to get here at the same time.
+  // Only one of them can install its MDO, so don't let the others allocate
+  // (under the loader's metaspace lock) and initialize one just to free it.
+  if (Atomic::load_acquire(&method->_method_data) != nullptr) {
+    return;
+  }
+
   ClassLoaderData* loader_data = method->method_holder()->class_loader_data();
   MethodData* method_data = MethodData::allocate(loader_data, method, THREAD);
   if (HAS_PENDING_EXCEPTION) {
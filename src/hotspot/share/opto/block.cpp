@@ -97,6 +97,11 @@ uint Block::compute_loop_alignment() {
                                 h->as_CountedLoop()->is_post_loop())) {
       return (OptoLoopAlignment > 4*unit_sz) ? (OptoLoopAlignment>>2) : unit_sz;
     }
+    // Loops on cold paths (same threshold as PhaseCFG::is_uncommon) only
+    // add padding to code that is rarely executed.
+    if (_freq < BLOCK_FREQUENCY(0.00001f)) {
+      return unit_sz;
+    }
     // Loops with low backedge frequency should not be aligned.
     Node *n = h->in(LoopNode::LoopBackControl)->in(0);
     if (n->is_MachIf() && n->as_MachIf()->_prob < 0.01) {
@@ -22,6 +22,7 @@
  *
  */
 
+#include "ci/bcEscapeAnalyzer.hpp"
 #include "ci/ciReplay.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "compiler/compilationPolicy.hpp"
@@ -32,6 +33,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "opto/callGenerator.hpp"
+#include "opto/callnode.hpp"
 #include "opto/parse.hpp"
 #include "runtime/handles.inline.hpp"
 #include "utilities/events.hpp"
@@ -104,6 +106,38 @@ static bool is_init_with_ea(ciMethod* callee_method,
   return false;
 }
 
+/**
+ *  Return true when EA is ON and one of the arguments is an allocation in
+ *  the caller which, according to the bytecode escape analyzer, does not
+ *  escape the callee. Inlining such a callee lets C2 scalar replace the
+ *  allocation, which it cannot do across a call.
+ */
+static bool is_arg_allocation_with_ea(ciMethod* callee_method,
+                                      JVMState* caller_jvms, Compile* C) {
+  if (!InlineForNonEscapingAllocations ||
+      !C->do_escape_analysis() || !EliminateAllocations) {
+    return false; // EA is off
+  }
+  SafePointNode* map = caller_jvms->map();
+  if (map == nullptr || callee_method->is_native() || callee_method->is_abstract()) {
+    return false;
+  }
+  for (int k = 0; k < callee_method->arg_size(); k++) {
+    uint idx = caller_jvms->argoff() + k;
+    if (idx >= map->req()) {
+      break;
+    }
+    Node* arg = map->in(idx);
+    if (arg != nullptr && arg->bottom_type()->isa_oopptr() != nullptr &&
+        AllocateNode::Ideal_allocation(arg) != nullptr &&
+        callee_method->get_bcea()->is_arg_local(k)) {
+      // Only run the bytecode analysis once we found an allocation.
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
  *  Force inlining unboxing accessor.
  */
@@ -165,7 +199,8 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   // bump the max size if the call is frequent
   if ((freq >= InlineFrequencyRatio) ||
       is_unboxing_method(callee_method, C) ||
-      is_init_with_ea(callee_method, caller_method, C)) {
+      is_init_with_ea(callee_method, caller_method, C) ||
+      is_arg_allocation_with_ea(callee_method, caller_jvms, C)) {
 
     max_inline_size = C->freq_inline_size();
     if (size <= max_inline_size && TraceFrequencyInlining) {
@@ -565,6 +565,10 @@
           "Number of fields in instance limit for scalar replacement")      \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, InlineForNonEscapingAllocations, false, EXPERIMENTAL,       \
+          "Treat a call site as hot for inlining if a fresh allocation "    \
+          "is passed to a callee that does not let it escape")              \
+                                                                            \
   product(bool, OptimizePtrCompare, true,                                   \
           "Use escape analysis to optimize pointers compare")               \
                                                                             \
@@ -741,6 +745,11 @@
           "The maximum bytecode size of a frequent method to be inlined")   \
           range(0, max_jint)                                                \
                                                                             \
+  product(uintx, ReduceFreqInlineSizeAt, 100, EXPERIMENTAL,                 \
+          "Scale FreqInlineSize down towards MaxInlineSize once the code "  \
+          "cache is filled by the specified percentage (100 disables)")     \
+          range(0, 100)                                                     \
+                                                                            \
   product(intx, MaxTrivialSize, 6,                                          \
           "The maximum bytecode size of a trivial method to be inlined by " \
           "high tier compiler")                                             \
@@ -212,8 +212,8 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, boo
   }
 }
 
-void C2Compiler::print_timers() {
-  Compile::print_timers();
+void C2Compiler::print_timers(outputStream* st) {
+  Compile::print_timers(st);
 }
 
 bool C2Compiler::is_intrinsic_supported(const methodHandle& method) {
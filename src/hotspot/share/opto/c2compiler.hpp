@@ -60,7 +60,7 @@ class C2Compiler : public AbstractCompiler {
   static const char* retry_no_superword();
 
   // Print compilation timers and statistics
-  void print_timers();
+  void print_timers(outputStream* st);
 
   // Return true if the intrinsification of a method supported by the compiler
   // assuming a non-virtual dispatch. (A virtual dispatch is
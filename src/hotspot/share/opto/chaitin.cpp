@@ -688,7 +688,10 @@ void PhaseChaitin::Register_Allocate() {
   // Log regalloc results
   CompileLog* log = Compile::current()->log();
   if (log != nullptr) {
-    log->elem("regalloc attempts='%d' success='%d'", _trip_cnt, !C->failing());
+    // Size of the problem, to tell apart methods where allocation is
+    // expensive because of many live ranges from ones that need many rounds.
+    log->elem("regalloc attempts='%d' success='%d' live_ranges='%u' blocks='%u'",
+              _trip_cnt, !C->failing(), _lrg_map.max_lrg_id(), _cfg.number_of_blocks());
   }
 
   if (C->failing()) {
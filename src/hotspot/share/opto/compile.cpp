@@ -27,6 +27,7 @@
 #include "ci/ciReplay.hpp"
 #include "classfile/javaClasses.hpp"
 #include "code/aotCodeCache.hpp"
+#include "code/codeCache.hpp"
 #include "code/exceptionHandlerTable.hpp"
 #include "code/nmethod.hpp"
 #include "compiler/compilationFailureInfo.hpp"
@@ -1075,6 +1076,15 @@ void Compile::Init(bool aliasing) {
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
+  if (ReduceFreqInlineSizeAt < 100 && FreqInlineSize > MaxInlineSize) {
+    // Under code cache pressure, shrink the budget for hot call sites linearly
+    // from FreqInlineSize at the threshold down to MaxInlineSize when full.
+    double used_percent = 100.0 - 100.0 / CodeCache::reverse_free_ratio();
+    if (used_percent > ReduceFreqInlineSizeAt) {
+      double factor = (100.0 - used_percent) / (100.0 - ReduceFreqInlineSizeAt);
+      set_freq_inline_size((int)(MaxInlineSize + (FreqInlineSize - MaxInlineSize) * factor));
+    }
+  }
   set_do_scheduling(OptoScheduling);
 
   set_do_vector_loop(false);
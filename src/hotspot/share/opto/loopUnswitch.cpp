@@ -23,6 +23,8 @@
  */
 
 #include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "opto/callnode.hpp"
 #include "opto/castnode.hpp"
 #include "opto/cfgnode.hpp"
 #include "opto/connode.hpp"
@@ -104,6 +106,31 @@
 //    Endloop                           Endloop
 
 
+#ifndef PRODUCT
+// Report virtual calls in the loop whose receiver is loop-invariant. Their
+// receiver type check is done inside the callee (or the vtable/itable stub),
+// so there is no invariant If for us to unswitch on. These are the loops that
+// would profit from versioning on the receiver's klass.
+static void trace_invariant_receiver_calls(const IdealLoopTree* loop) {
+  if (!TraceLoopUnswitching) {
+    return;
+  }
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    if (n->is_CallDynamicJava() && n->as_CallDynamicJava()->method() != nullptr) {
+      CallDynamicJavaNode* call = n->as_CallDynamicJava();
+      Node* receiver = call->in(TypeFunc::Parms);
+      if (loop->is_invariant(receiver)) {
+        ResourceMark rm;
+        tty->print_cr("Loop Unswitching \"%d %s\": virtual call %d to %s has a loop-invariant receiver",
+                      loop->_head->_idx, loop->_head->Name(), call->_idx,
+                      call->method()->name()->as_utf8());
+      }
+    }
+  }
+}
+#endif
+
 // Return true if the loop should be unswitched or false otherwise.
 bool IdealLoopTree::policy_unswitching(PhaseIdealLoop* phase) const {
   if (!LoopUnswitching) {
@@ -126,6 +153,7 @@ bool IdealLoopTree::policy_unswitching(PhaseIdealLoop* phase) const {
     return false;
   }
   if (phase->find_unswitch_candidate(this) == nullptr) {
+    NOT_PRODUCT(trace_invariant_receiver_calls(this);)
     return false;
   }
 
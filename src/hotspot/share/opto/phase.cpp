@@ -56,47 +56,47 @@ Phase::Phase( PhaseNumber pnum ) : _pnum(pnum), C( pnum == Compiler ? nullptr :
   CompileBroker::maybe_block();
 }
 
-void Phase::print_timers() {
-  tty->print_cr ("    C2 Compile Time:      %7.3f s", Phase::_t_totalCompilation.seconds());
-  tty->print_cr ("       Parse:               %7.3f s", timers[_t_parser].seconds());
+void Phase::print_timers(outputStream* st) {
+  st->print_cr ("    C2 Compile Time:      %7.3f s", Phase::_t_totalCompilation.seconds());
+  st->print_cr ("       Parse:               %7.3f s", timers[_t_parser].seconds());
 
   {
-    tty->print_cr ("       Optimize:            %7.3f s", timers[_t_optimizer].seconds());
+    st->print_cr ("       Optimize:            %7.3f s", timers[_t_optimizer].seconds());
     if (DoEscapeAnalysis) {
       // EA is part of Optimizer.
-      tty->print_cr ("         Escape Analysis:     %7.3f s", timers[_t_escapeAnalysis].seconds());
-      tty->print_cr ("           Conn Graph:          %7.3f s", timers[_t_connectionGraph].seconds());
-      tty->print_cr ("           Macro Eliminate:     %7.3f s", timers[_t_macroEliminate].seconds());
+      st->print_cr ("         Escape Analysis:     %7.3f s", timers[_t_escapeAnalysis].seconds());
+      st->print_cr ("           Conn Graph:          %7.3f s", timers[_t_connectionGraph].seconds());
+      st->print_cr ("           Macro Eliminate:     %7.3f s", timers[_t_macroEliminate].seconds());
     }
-    tty->print_cr ("         GVN 1:               %7.3f s", timers[_t_iterGVN].seconds());
+    st->print_cr ("         GVN 1:               %7.3f s", timers[_t_iterGVN].seconds());
 
     {
-       tty->print_cr ("         Incremental Inline:  %7.3f s", timers[_t_incrInline].seconds());
-       tty->print_cr ("           IdealLoop:           %7.3f s", timers[_t_incrInline_ideal].seconds());
-       tty->print_cr ("          (IGVN:                %7.3f s)", timers[_t_incrInline_igvn].seconds());
-       tty->print_cr ("          (Inline:              %7.3f s)", timers[_t_incrInline_inline].seconds());
-       tty->print_cr ("          (Prune Useless:       %7.3f s)", timers[_t_incrInline_pru].seconds());
+       st->print_cr ("         Incremental Inline:  %7.3f s", timers[_t_incrInline].seconds());
+       st->print_cr ("           IdealLoop:           %7.3f s", timers[_t_incrInline_ideal].seconds());
+       st->print_cr ("          (IGVN:                %7.3f s)", timers[_t_incrInline_igvn].seconds());
+       st->print_cr ("          (Inline:              %7.3f s)", timers[_t_incrInline_inline].seconds());
+       st->print_cr ("          (Prune Useless:       %7.3f s)", timers[_t_incrInline_pru].seconds());
 
        double other = timers[_t_incrInline].seconds() -
         (timers[_t_incrInline_ideal].seconds());
        if (other > 0) {
-         tty->print_cr("           Other:               %7.3f s", other);
+         st->print_cr("           Other:               %7.3f s", other);
        }
     }
 
-    tty->print_cr ("         Vector:              %7.3f s", timers[_t_vector].seconds());
-    tty->print_cr ("           Box elimination:   %7.3f s", timers[_t_vector_elimination].seconds());
-    tty->print_cr ("             IGVN:            %7.3f s", timers[_t_vector_igvn].seconds());
-    tty->print_cr ("             Prune Useless:   %7.3f s", timers[_t_vector_pru].seconds());
-    tty->print_cr ("         Renumber Live:       %7.3f s", timers[_t_renumberLive].seconds());
-    tty->print_cr ("         IdealLoop:           %7.3f s", timers[_t_idealLoop].seconds());
-    tty->print_cr ("           AutoVectorize:     %7.3f s", timers[_t_autoVectorize].seconds());
-    tty->print_cr ("         IdealLoop Verify:    %7.3f s", timers[_t_idealLoopVerify].seconds());
-    tty->print_cr ("         Cond Const Prop:     %7.3f s", timers[_t_ccp].seconds());
-    tty->print_cr ("         GVN 2:               %7.3f s", timers[_t_iterGVN2].seconds());
-    tty->print_cr ("         Macro Expand:        %7.3f s", timers[_t_macroExpand].seconds());
-    tty->print_cr ("         Barrier Expand:      %7.3f s", timers[_t_barrierExpand].seconds());
-    tty->print_cr ("         Graph Reshape:       %7.3f s", timers[_t_graphReshaping].seconds());
+    st->print_cr ("         Vector:              %7.3f s", timers[_t_vector].seconds());
+    st->print_cr ("           Box elimination:   %7.3f s", timers[_t_vector_elimination].seconds());
+    st->print_cr ("             IGVN:            %7.3f s", timers[_t_vector_igvn].seconds());
+    st->print_cr ("             Prune Useless:   %7.3f s", timers[_t_vector_pru].seconds());
+    st->print_cr ("         Renumber Live:       %7.3f s", timers[_t_renumberLive].seconds());
+    st->print_cr ("         IdealLoop:           %7.3f s", timers[_t_idealLoop].seconds());
+    st->print_cr ("           AutoVectorize:     %7.3f s", timers[_t_autoVectorize].seconds());
+    st->print_cr ("         IdealLoop Verify:    %7.3f s", timers[_t_idealLoopVerify].seconds());
+    st->print_cr ("         Cond Const Prop:     %7.3f s", timers[_t_ccp].seconds());
+    st->print_cr ("         GVN 2:               %7.3f s", timers[_t_iterGVN2].seconds());
+    st->print_cr ("         Macro Expand:        %7.3f s", timers[_t_macroExpand].seconds());
+    st->print_cr ("         Barrier Expand:      %7.3f s", timers[_t_barrierExpand].seconds());
+    st->print_cr ("         Graph Reshape:       %7.3f s", timers[_t_graphReshaping].seconds());
 
     double other = timers[_t_optimizer].seconds() -
       (timers[_t_escapeAnalysis].seconds() +
@@ -112,33 +112,33 @@ void Phase::print_timers() {
        timers[_t_barrierExpand].seconds() +
        timers[_t_graphReshaping].seconds());
     if (other > 0) {
-      tty->print_cr("         Other:               %7.3f s", other);
+      st->print_cr("         Other:               %7.3f s", other);
     }
   }
 
-  tty->print_cr ("       Matcher:                  %7.3f s", timers[_t_matcher].seconds());
+  st->print_cr ("       Matcher:                  %7.3f s", timers[_t_matcher].seconds());
   if (Matcher::supports_generic_vector_operands) {
-    tty->print_cr ("         Post Selection Cleanup: %7.3f s", timers[_t_postselect_cleanup].seconds());
+    st->print_cr ("         Post Selection Cleanup: %7.3f s", timers[_t_postselect_cleanup].seconds());
   }
-  tty->print_cr ("       Scheduler:                %7.3f s", timers[_t_scheduler].seconds());
+  st->print_cr ("       Scheduler:                %7.3f s", timers[_t_scheduler].seconds());
 
   {
-    tty->print_cr ("       Regalloc:            %7.3f s", timers[_t_registerAllocation].seconds());
-    tty->print_cr ("         Ctor Chaitin:        %7.3f s", timers[_t_ctorChaitin].seconds());
-    tty->print_cr ("         Build IFG (virt):    %7.3f s", timers[_t_buildIFGvirtual].seconds());
-    tty->print_cr ("         Build IFG (phys):    %7.3f s", timers[_t_buildIFGphysical].seconds());
-    tty->print_cr ("         Compute Liveness:    %7.3f s", timers[_t_computeLive].seconds());
-    tty->print_cr ("         Regalloc Split:      %7.3f s", timers[_t_regAllocSplit].seconds());
-    tty->print_cr ("         Postalloc Copy Rem:  %7.3f s", timers[_t_postAllocCopyRemoval].seconds());
-    tty->print_cr ("         Merge multidefs:     %7.3f s", timers[_t_mergeMultidefs].seconds());
-    tty->print_cr ("         Fixup Spills:        %7.3f s", timers[_t_fixupSpills].seconds());
-    tty->print_cr ("         Compact:             %7.3f s", timers[_t_chaitinCompact].seconds());
-    tty->print_cr ("         Coalesce 1:          %7.3f s", timers[_t_chaitinCoalesce1].seconds());
-    tty->print_cr ("         Coalesce 2:          %7.3f s", timers[_t_chaitinCoalesce2].seconds());
-    tty->print_cr ("         Coalesce 3:          %7.3f s", timers[_t_chaitinCoalesce3].seconds());
-    tty->print_cr ("         Cache LRG:           %7.3f s", timers[_t_chaitinCacheLRG].seconds());
-    tty->print_cr ("         Simplify:            %7.3f s", timers[_t_chaitinSimplify].seconds());
-    tty->print_cr ("         Select:              %7.3f s", timers[_t_chaitinSelect].seconds());
+    st->print_cr ("       Regalloc:            %7.3f s", timers[_t_registerAllocation].seconds());
+    st->print_cr ("         Ctor Chaitin:        %7.3f s", timers[_t_ctorChaitin].seconds());
+    st->print_cr ("         Build IFG (virt):    %7.3f s", timers[_t_buildIFGvirtual].seconds());
+    st->print_cr ("         Build IFG (phys):    %7.3f s", timers[_t_buildIFGphysical].seconds());
+    st->print_cr ("         Compute Liveness:    %7.3f s", timers[_t_computeLive].seconds());
+    st->print_cr ("         Regalloc Split:      %7.3f s", timers[_t_regAllocSplit].seconds());
+    st->print_cr ("         Postalloc Copy Rem:  %7.3f s", timers[_t_postAllocCopyRemoval].seconds());
+    st->print_cr ("         Merge multidefs:     %7.3f s", timers[_t_mergeMultidefs].seconds());
+    st->print_cr ("         Fixup Spills:        %7.3f s", timers[_t_fixupSpills].seconds());
+    st->print_cr ("         Compact:             %7.3f s", timers[_t_chaitinCompact].seconds());
+    st->print_cr ("         Coalesce 1:          %7.3f s", timers[_t_chaitinCoalesce1].seconds());
+    st->print_cr ("         Coalesce 2:          %7.3f s", timers[_t_chaitinCoalesce2].seconds());
+    st->print_cr ("         Coalesce 3:          %7.3f s", timers[_t_chaitinCoalesce3].seconds());
+    st->print_cr ("         Cache LRG:           %7.3f s", timers[_t_chaitinCacheLRG].seconds());
+    st->print_cr ("         Simplify:            %7.3f s", timers[_t_chaitinSimplify].seconds());
+    st->print_cr ("         Select:              %7.3f s", timers[_t_chaitinSelect].seconds());
 
     double other = timers[_t_registerAllocation].seconds() -
       (timers[_t_ctorChaitin].seconds() +
@@ -158,20 +158,20 @@ void Phase::print_timers() {
        timers[_t_chaitinSelect].seconds());
 
     if (other > 0) {
-      tty->print_cr("         Other:               %7.3f s", other);
+      st->print_cr("         Other:               %7.3f s", other);
     }
   }
-  tty->print_cr ("       Block Ordering:      %7.3f s", timers[_t_blockOrdering].seconds());
-  tty->print_cr ("       Peephole:            %7.3f s", timers[_t_peephole].seconds());
+  st->print_cr ("       Block Ordering:      %7.3f s", timers[_t_blockOrdering].seconds());
+  st->print_cr ("       Peephole:            %7.3f s", timers[_t_peephole].seconds());
   if (Matcher::require_postalloc_expand) {
-    tty->print_cr ("       Postalloc Expand:    %7.3f s", timers[_t_postalloc_expand].seconds());
+    st->print_cr ("       Postalloc Expand:    %7.3f s", timers[_t_postalloc_expand].seconds());
   }
-  tty->print_cr ("       Code Emission:         %7.3f s", timers[_t_output].seconds());
-  tty->print_cr ("         Insn Scheduling:     %7.3f s", timers[_t_instrSched].seconds());
-  tty->print_cr ("         Shorten branches:    %7.3f s", timers[_t_shortenBranches].seconds());
-  tty->print_cr ("         Build OOP maps:      %7.3f s", timers[_t_buildOopMaps].seconds());
-  tty->print_cr ("         Fill buffer:         %7.3f s", timers[_t_fillBuffer].seconds());
-  tty->print_cr ("         Code Installation:   %7.3f s", timers[_t_registerMethod].seconds());
+  st->print_cr ("       Code Emission:         %7.3f s", timers[_t_output].seconds());
+  st->print_cr ("         Insn Scheduling:     %7.3f s", timers[_t_instrSched].seconds());
+  st->print_cr ("         Shorten branches:    %7.3f s", timers[_t_shortenBranches].seconds());
+  st->print_cr ("         Build OOP maps:      %7.3f s", timers[_t_buildOopMaps].seconds());
+  st->print_cr ("         Fill buffer:         %7.3f s", timers[_t_fillBuffer].seconds());
+  st->print_cr ("         Code Installation:   %7.3f s", timers[_t_registerMethod].seconds());
 
   {
     double other = timers[_t_output].seconds() -
@@ -182,17 +182,17 @@ void Phase::print_timers() {
                     timers[_t_registerMethod].seconds());
 
     if (other > 0) {
-      tty->print_cr("         Other:               %7.3f s", other);
+      st->print_cr("         Other:               %7.3f s", other);
     }
   }
 
   if( timers[_t_temporaryTimer1].seconds() > 0 ) {
-    tty->cr();
-    tty->print_cr ("       Temp Timer 1:        %7.3f s", timers[_t_temporaryTimer1].seconds());
+    st->cr();
+    st->print_cr ("       Temp Timer 1:        %7.3f s", timers[_t_temporaryTimer1].seconds());
   }
   if( timers[_t_temporaryTimer2].seconds() > 0 ) {
-    tty->cr();
-    tty->print_cr ("       Temp Timer 2:        %7.3f s", timers[_t_temporaryTimer2].seconds());
+    st->cr();
+    st->print_cr ("       Temp Timer 2:        %7.3f s", timers[_t_temporaryTimer2].seconds());
   }
 
    double other = Phase::_t_totalCompilation.seconds() -
@@ -209,7 +209,7 @@ void Phase::print_timers() {
        timers[_t_temporaryTimer1].seconds() +
        timers[_t_temporaryTimer2].seconds());
     if (other > 0) {
-      tty->print_cr("       Other:               %7.3f s", other);
+      st->print_cr("       Other:               %7.3f s", other);
     }
 
 }
@@ -160,7 +160,7 @@ class Phase : public StackObj {
   Phase( PhaseNumber pnum );
   NONCOPYABLE(Phase);
 
-  static void print_timers();
+  static void print_timers(outputStream* st);
 };
 
 #endif // SHARE_OPTO_PHASE_HPP
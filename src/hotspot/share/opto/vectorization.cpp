@@ -50,6 +50,41 @@ bool VLoop::check_preconditions() {
   return true; // success
 }
 
+// Search loops ("find the first element matching a predicate") have a
+// data-dependent exit in the body. We do not vectorize them yet, but report
+// them separately from other control flow, so they can be told apart.
+// Exits into uncommon traps, such as null and range check guards, are not
+// early exits: they deoptimize instead of leaving the loop.
+bool VLoop::has_early_exit() const {
+  Node* n = _cl_exit->in(0);
+  while (n != _cl) {
+    if (n->is_If()) {
+      Node* exit = _lpt->is_loop_exit(n);
+      if (exit != nullptr && exit->as_Proj()->is_uncommon_trap_proj() == nullptr) {
+        return true;
+      }
+    }
+    n = _phase->idom(n);
+  }
+  return false;
+}
+
+// Filter kernels ("if (a[i] > t) b[i] = c[i]") could become masked vector
+// stores after if-conversion, which we do not do yet. Like early exits, we
+// report them separately from other control flow.
+bool VLoop::has_conditional_store() const {
+  for (uint i = 0; i < _lpt->_body.size(); i++) {
+    Node* n = _lpt->_body.at(i);
+    if (n->is_Store()) {
+      Node* ctrl = n->in(MemNode::Control);
+      if (ctrl != nullptr && ctrl->is_IfProj() && _lpt->is_member(_phase->get_loop(ctrl))) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 VStatus VLoop::check_preconditions_helper() {
   // Only accept vector width that is power of 2
   int vector_width = Matcher::vector_width_in_bytes(T_BYTE);
@@ -85,6 +120,12 @@ VStatus VLoop::check_preconditions_helper() {
       _lpt->dump_head();
     }
 #endif
+    if (has_early_exit()) {
+      return VStatus::make_failure(VLoop::FAILURE_EARLY_EXIT);
+    }
+    if (has_conditional_store()) {
+      return VStatus::make_failure(VLoop::FAILURE_CONDITIONAL_STORE);
+    }
     return VStatus::make_failure(VLoop::FAILURE_CONTROL_FLOW);
   }
 
@@ -289,6 +330,16 @@ void VLoopDependencyGraph::construct() {
         if (!p1.never_overlaps_with(p2)) {
           // Possibly overlapping memory
           memory_pred_edges.append(_body.bb_idx(n2));
+#ifndef PRODUCT
+          if (_vloop.is_trace_dependency_graph() && is_aliasing_check_candidate(p1, p2)) {
+            // E.g. two MemorySegments: a runtime aliasing check on the two bases
+            // could remove this edge in a multiversioned fast-loop.
+            tty->print_cr("VLoopDependencyGraph::construct: edge %d -> %d only due to unknown aliasing of bases %d and %d",
+                          n2->_idx, n1->_idx,
+                          p2.mem_pointer().base().object_or_native()->_idx,
+                          p1.mem_pointer().base().object_or_native()->_idx);
+          }
+#endif
         }
       }
       if (memory_pred_edges.is_nonempty()) {
@@ -305,6 +356,18 @@ void VLoopDependencyGraph::construct() {
   NOT_PRODUCT( if (_vloop.is_trace_dependency_graph()) { print(); } )
 }
 
+#ifndef PRODUCT
+// Both pointers have a known base, but the bases are different nodes, so we
+// cannot prove anything about their relative position at compile time.
+bool VLoopDependencyGraph::is_aliasing_check_candidate(const VPointer& p1, const VPointer& p2) {
+  if (!p1.is_valid() || !p2.is_valid()) { return false; }
+  const MemPointer::Base& b1 = p1.mem_pointer().base();
+  const MemPointer::Base& b2 = p2.mem_pointer().base();
+  return b1.is_known() && b2.is_known() &&
+         b1.object_or_native() != b2.object_or_native();
+}
+#endif
+
 void VLoopDependencyGraph::add_node(MemNode* n, GrowableArray<int>& memory_pred_edges) {
   assert(_dependency_nodes.at_grow(_body.bb_idx(n), nullptr) == nullptr, "not yet created");
   assert(!memory_pred_edges.is_empty(), "no need to create a node without edges");
@@ -101,6 +101,8 @@ class VLoop : public StackObj {
   static constexpr char const* FAILURE_VECTOR_WIDTH       = "vector_width must be power of 2";
   static constexpr char const* FAILURE_VALID_COUNTED_LOOP = "must be valid counted loop (int)";
   static constexpr char const* FAILURE_CONTROL_FLOW       = "control flow in loop not allowed";
+  static constexpr char const* FAILURE_EARLY_EXIT         = "loop with early exit not supported";
+  static constexpr char const* FAILURE_CONDITIONAL_STORE  = "conditional store in loop not supported";
   static constexpr char const* FAILURE_BACKEDGE           = "nodes on backedge not allowed";
   static constexpr char const* FAILURE_PRE_LOOP_LIMIT     = "main-loop must be able to adjust pre-loop-limit (not found)";
 
@@ -239,6 +241,12 @@ class VLoop : public StackObj {
 
 private:
   VStatus check_preconditions_helper();
+
+  // Does the loop body contain an exit other than the counted loop end?
+  bool has_early_exit() const;
+
+  // Is there a store in the loop body that is only executed on one side of a branch?
+  bool has_conditional_store() const;
 };
 
 // Optimization to keep allocation of large arrays in AutoVectorization low.
@@ -612,6 +620,7 @@ class VLoopDependencyGraph : public StackObj {
 
 private:
   void add_node(MemNode* n, GrowableArray<int>& memory_pred_edges);
+  NOT_PRODUCT( static bool is_aliasing_check_candidate(const VPointer& p1, const VPointer& p2); )
   int depth(const Node* n) const { return _depths.at(_body.bb_idx(n)); }
   void set_depth(const Node* n, int d) { _depths.at_put(_body.bb_idx(n), d); }
   int find_max_pred_depth(const Node* n) const;
@@ -1064,7 +1064,20 @@ freeze_result FreezeBase::finalize_freeze(const frame& callee, frame& caller, in
     _freeze_size += overlap; // we're allocating a new chunk, so no overlap
     // overlap = 0;
 
-    chunk = allocate_chunk_slow(_freeze_size, argsize_md);
+    // Virtual threads tend to yield at varying stack depths. Giving a new
+    // chunk some headroom lets the next freeze reuse it once it has been
+    // emptied by thaw, instead of allocating yet another chunk.
+    size_t chunk_stack_size = _freeze_size;
+    if (ContinuationChunkSlackPercent > 0) {
+      size_t slack = align_up((size_t)_freeze_size * ContinuationChunkSlackPercent / 100, 2);
+      size_t max_size = CollectedHeap::stack_chunk_max_size();
+      InstanceStackChunkKlass* klass = InstanceStackChunkKlass::cast(vmClasses::StackChunk_klass());
+      if (max_size == 0 || klass->instance_size(chunk_stack_size + slack) < max_size) {
+        chunk_stack_size += slack;
+      }
+    }
+
+    chunk = allocate_chunk_slow(chunk_stack_size, argsize_md);
     if (chunk == nullptr) {
       return freeze_exception;
     }
@@ -2153,7 +2166,7 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
   }
 
   // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
-  static const int threshold = 500; // words
+  const int threshold = ContinuationFastThawThreshold; // words
 
   const int full_chunk_size = chunk->stack_size() - chunk->sp(); // this initial size could be reduced if it's a partial thaw
   int argsize, thaw_size;
@@ -2303,7 +2316,9 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_slow(stackChunkOop chunk, Continuation::t
 
   DEBUG_ONLY(_frames = 0;)
   _align_size = 0;
-  int num_frames = kind == Continuation::thaw_top ? 2 : 1;
+  // Thawing more frames at once trades a longer thaw for fewer trips
+  // through the return barrier when the code returns deeply after resuming.
+  int num_frames = ContinuationReturnBarrierThawFrames + (kind == Continuation::thaw_top ? 1 : 0);
 
   _stream = StackChunkFrameStream<ChunkFrames::Mixed>(chunk);
   _top_unextended_sp_before_thaw = _stream.unextended_sp();
@@ -2483,6 +2483,13 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
     }
     if (inc_recompile_count) {
       trap_mdo->inc_overflow_recompile_count();
+      if (log_is_enabled(Info, deoptimization)) {
+        ResourceMark rm;
+        log_info(deoptimization)("Repeated recompilation of %s @ %d: reason=%s recompiles=%u/%d decompiles=%u",
+                                 trap_method->name_and_sig_as_C_string(), trap_bci, trap_reason_name(reason),
+                                 trap_mdo->overflow_recompile_count(), (int)PerBytecodeRecompilationCutoff,
+                                 trap_mdo->decompile_count());
+      }
       if ((uint)trap_mdo->overflow_recompile_count() >
           (uint)PerBytecodeRecompilationCutoff) {
         // Give up on the method containing the bad BCI.
@@ -2504,6 +2511,11 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
     if (make_not_compilable && !nm->method()->is_not_compilable(CompLevel_full_optimization)) {
       assert(make_not_entrant, "consistent");
       nm->method()->set_not_compilable("give up compiling", CompLevel_full_optimization);
+      if (log_is_enabled(Info, deoptimization)) {
+        ResourceMark rm;
+        log_info(deoptimization)("Giving up compiling %s after repeated deoptimization: reason=%s @ %d",
+                                 nm->method()->name_and_sig_as_C_string(), trap_reason_name(reason), trap_bci);
+      }
     }
 
     if (ProfileExceptionHandlers && trap_mdo != nullptr) {
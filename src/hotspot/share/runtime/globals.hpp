@@ -590,6 +590,13 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
+  product(uint, NMTMallocStackSampleRate, 1, EXPERIMENTAL,                  \
+          "With NativeMemoryTracking=detail, record the call stack of "     \
+          "only one in n mallocs per thread on average, at pseudo-random "  \
+          "intervals; the other mallocs are attributed to the empty call "  \
+          "stack site. Totals stay exact. 1 records every call stack")      \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, LogCompilation, false, DIAGNOSTIC,                          \
           "Log compilation activity in detail to LogFile")                  \
                                                                             \
@@ -751,6 +758,12 @@ const int ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                                 \
           range(1024, max_jint)                                             \
                                                                             \
+  product(uintx, MonitorDeflationMaxTime, 0, DIAGNOSTIC,                    \
+          "The maximum time in milliseconds spent deflating monitors in "   \
+          "one deflation cycle. Remaining monitors are deflated in an "     \
+          "immediately following cycle (0 is unbounded).")                  \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, MonitorUnlinkBatch, 500, DIAGNOSTIC,                        \
           "The maximum number of monitors to unlink in one batch. ")        \
           range(1, max_jint)                                                \
@@ -805,6 +818,13 @@ const int ObjectAlignmentInBytes = 8;
           "where <= 0 is unlimited, default: 65536")                        \
           range(min_intx, max_intx)                                         \
                                                                             \
+  product(uint, JNIGlobalHandleCacheSize, 0, EXPERIMENTAL,                  \
+          "Number of released global JNI handle entries each thread keeps " \
+          "for reuse, and the batch size in which new entries are taken "   \
+          "from the global handle storage. 0 disables the cache. Ignored "  \
+          "with CheckJNICalls")                                             \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, EagerXrunInit, false,                                       \
           "Eagerly initialize -Xrun libraries; allows startup profiling, "  \
           "but not all -Xrun libraries may support the state of the VM "    \
@@ -939,6 +959,10 @@ const int ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(bool, LimitCompilerThreadsToActiveProcessors, false, EXPERIMENTAL,\
+          "Do not dynamically add compiler threads beyond the number of "   \
+          "active processors, e.g. the container CPU quota")                \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -963,6 +987,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uint, ThreadSMRFreeListBatchSize, 1, DIAGNOSTIC,                  \
+          "Number of retired ThreadsLists to collect before scanning the "  \
+          "hazard pointers of all threads to free them")                    \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -1194,6 +1223,14 @@ const int ObjectAlignmentInBytes = 8;
   develop_pd(bool, ProfileTraps,                                            \
           "Profile deoptimization traps at the bytecode level")             \
                                                                             \
+  product(uint, InterpreterProfileSampleRate, 1, EXPERIMENTAL,              \
+          "Update call and type check counters in the interpreter on "      \
+          "average once in every N profiled events of a thread, at "        \
+          "pseudo-random intervals, scaling the update by N. Branch "       \
+          "counters are always updated. 1 updates on every event. Only "    \
+          "supported on x86_64")                                            \
+          range(1, 1024)                                                    \
+                                                                            \
   product(intx, ProfileMaturityPercentage, 20,                              \
           "number of method invocations/branches (expressed as % of "       \
           "CompileThreshold) before using the method's profile")            \
@@ -1909,6 +1946,22 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, VMContinuations, EXPERIMENTAL,                           \
           "Enable VM continuations support")                                \
                                                                             \
+  product(uint, ContinuationChunkSlackPercent, 0, EXPERIMENTAL,             \
+          "Extra space, in percent of the frozen frames, added to stack "   \
+          "chunks allocated by the slow freeze path, so that later "        \
+          "freezes of a slightly deeper stack can reuse the chunk")         \
+          range(0, 400)                                                     \
+                                                                            \
+  product(int, ContinuationFastThawThreshold, 500, EXPERIMENTAL,            \
+          "Size in words up to which the fast thaw path copies the whole "  \
+          "stack chunk back to the stack rather than only its top frame")   \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(int, ContinuationReturnBarrierThawFrames, 1, EXPERIMENTAL,        \
+          "Number of frames the slow thaw path thaws at a return barrier; " \
+          "one more frame is thawed when resuming a continuation")          \
+          range(1, 64)                                                      \
+                                                                            \
   develop(bool, LoomDeoptAfterThaw, false,                                  \
           "Deopt stack after thaw")                                         \
                                                                             \
@@ -1958,6 +2011,12 @@ const int ObjectAlignmentInBytes = 8;
           "With Lightweight Locking mode, use a table to record inflated "  \
           "monitors rather than the first word of the object.")             \
                                                                             \
+  product(int, ObjectMonitorTableCacheSize, 8, DIAGNOSTIC,                  \
+          "With UseObjectMonitorTable, the number of recently used "        \
+          "monitors each thread caches to avoid table lookups when "        \
+          "locking an inflated object")                                     \
+          range(1, 16)                                                      \
+                                                                            \
   product(int, LightweightFastLockingSpins, 13, DIAGNOSTIC,                 \
           "Specifies the number of times lightweight fast locking will "    \
           "attempt to CAS the markWord before inflating. Between each "     \
@@ -1972,6 +2031,13 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(uint, TrimNativeHeapMaxBackoff, 1, EXPERIMENTAL,                  \
+          "If a periodic native heap trim does not reduce the process "     \
+          "RSS, double the wait before the next trim, up to this "          \
+          "multiple of TrimNativeHeapInterval. The interval is reset "      \
+          "once a trim frees memory again. 1 disables the backoff.")        \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
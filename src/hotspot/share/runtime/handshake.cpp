@@ -280,6 +280,7 @@ class VM_HandshakeAllThreads: public VM_Operation {
       // Observing a blocked state may of course be transient but the processing is guarded
       // by mutexes and we optimistically begin by working on the blocked threads
       jtiwh.rewind();
+      uint visited = 0;
       for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
         // A new thread on the ThreadsList will not have an operation,
         // hence it is skipped in handshake_try_process.
@@ -288,6 +289,12 @@ class VM_HandshakeAllThreads: public VM_Operation {
         if (pr == HandshakeState::_succeeded) {
           emitted_handshakes_executed++;
         }
+        // With many threads, most of them have usually executed the
+        // operation themselves before the VM thread gets to them. Stop
+        // walking the list as soon as nobody is left.
+        if ((++visited % 128) == 0 && _op->is_completed()) {
+          break;
+        }
       }
       hsy.process();
     } while (!_op->is_completed());
@@ -245,7 +245,7 @@ static void print_bytecode_count() {}
 // General statistics printing (profiling ...)
 void print_statistics() {
   if (CITime) {
-    CompileBroker::print_times();
+    CompileBroker::print_times(tty);
   }
 
 #ifdef COMPILER1
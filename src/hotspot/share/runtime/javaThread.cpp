@@ -49,6 +49,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
+#include "oops/method.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "oops/verifyOopClosure.hpp"
@@ -430,6 +431,8 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _cached_global_handles(nullptr),
+  _cached_global_handles_count(0),
   _monitor_owner_id(0),
 
   _suspend_flags(0),
@@ -485,6 +488,9 @@ JavaThread::JavaThread(MemTag mem_tag) :
   // JVMTI PopFrame support
   _popframe_condition(popframe_inactive),
   _frames_to_pop_failed_realloc(0),
+  _profile_sample_countdown(0),
+  _interpreter_profile_countdown(0),
+  _profile_sample_seed((uint32_t)os::random()),
 
   _cont_entry(nullptr),
   _cont_fastpath(nullptr),
@@ -688,6 +694,9 @@ JavaThread::~JavaThread() {
     delete old_array;
   }
 
+  // Return cached global JNI handle entries to their storage.
+  JNIHandles::release_cached_global_handles(this);
+
   JvmtiDeferredUpdates* updates = deferred_updates();
   if (updates != nullptr) {
     // This can only happen if thread is destroyed before deoptimization occurs.
@@ -2344,7 +2353,33 @@ void JavaThread::post_vthread_pinned_event(EventVirtualThreadPinned* event, cons
                    class_being_initialized()->external_name());
       event->set_pinnedReason(reason);
     } else if (result == freeze_pinned_native) {
-      event->set_pinnedReason("Native or VM frame on stack");
+      // Name the native method if that is what pins us, so that the
+      // offending library can be identified from the recording. Skip the
+      // natives of VirtualThread and Continuation that are on the stack
+      // while the event is posted, and don't walk past the continuation
+      // entry into the carrier's frames.
+      const Method* native_method = nullptr;
+      if (has_last_Java_frame()) {
+        for (vframeStream vfst(this); !vfst.at_end(); vfst.next()) {
+          const Method* m = vfst.method();
+          if (m->is_continuation_enter_intrinsic()) {
+            break;
+          }
+          if (m->is_native() && !m->is_continuation_native_intrinsic() &&
+              m->method_holder() != vmClasses::VirtualThread_klass()) {
+            native_method = m;
+            break;
+          }
+        }
+      }
+      if (native_method != nullptr) {
+        ResourceMark rm(this);
+        jio_snprintf(reason, sizeof(reason), "Native frame of %s on stack",
+                     native_method->external_name());
+        event->set_pinnedReason(reason);
+      } else {
+        event->set_pinnedReason("Native or VM frame on stack");
+      }
     } else {
       jio_snprintf(reason, sizeof(reason), "Freeze or preempt failed (%d)", result);
       event->set_pinnedReason(reason);
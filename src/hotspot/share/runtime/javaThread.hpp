@@ -164,6 +164,11 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Thread local cache of unused global JNI handle entries, see
+  // JNIHandles::make_global() and JNIHandles::destroy_global().
+  oop**  _cached_global_handles;
+  uint   _cached_global_handles_count;
+
   // ID used as owner for inflated monitors. Same as the j.l.Thread.tid of the
   // current _vthread object, except during creation of the primordial and JNI
   // attached thread cases where this field can have a temporary value.
@@ -210,6 +215,11 @@ class JavaThread: public Thread {
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
+  oop** cached_global_handles() const            { return _cached_global_handles; }
+  void set_cached_global_handles(oop** cache)    { _cached_global_handles = cache; }
+  uint cached_global_handles_count() const       { return _cached_global_handles_count; }
+  void set_cached_global_handles_count(uint n)   { _cached_global_handles_count = n; }
+
   void push_jni_handle_block();
   void pop_jni_handle_block();
 
@@ -472,6 +482,13 @@ class JavaThread: public Thread {
   // failed reallocations.
   int _frames_to_pop_failed_realloc;
 
+  // Sampling of profile counter updates (see MacroAssembler::profile_sample).
+  // One countdown each for C1ProfileCallSampleRate in tier 3 code and for
+  // InterpreterProfileSampleRate, both re-armed from the same seed.
+  int _profile_sample_countdown;
+  int _interpreter_profile_countdown;
+  uint32_t _profile_sample_seed;
+
   ContinuationEntry* _cont_entry;
   intptr_t* _cont_fastpath; // the sp of the oldest known interpreted/call_stub/upcall_stub/native_wrapper
                             // frame inside the continuation that we know about
@@ -901,6 +918,10 @@ class JavaThread: public Thread {
 
   static ByteSize monitor_owner_id_offset()   { return byte_offset_of(JavaThread, _monitor_owner_id); }
 
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
+  static ByteSize profile_sample_seed_offset() { return byte_offset_of(JavaThread, _profile_sample_seed); }
+  static ByteSize interpreter_profile_countdown_offset() { return byte_offset_of(JavaThread, _interpreter_profile_countdown); }
+
   static ByteSize cont_entry_offset()         { return byte_offset_of(JavaThread, _cont_entry); }
   static ByteSize cont_fastpath_offset()      { return byte_offset_of(JavaThread, _cont_fastpath); }
   static ByteSize held_monitor_count_offset() { return byte_offset_of(JavaThread, _held_monitor_count); }
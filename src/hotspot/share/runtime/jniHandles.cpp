@@ -34,6 +34,7 @@
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -81,6 +82,73 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// Threads that create and destroy many global handles contend on the
+// allocation lock of the global handle storage. With a cache, a thread
+// takes entries from the storage in batches and keeps released entries
+// around for reuse. Cached entries hold null, which the GC ignores.
+// CheckJNICalls needs released entries to be detectable as such, so the
+// cache is not used then.
+bool JNIHandles::use_global_handle_cache() {
+  return JNIGlobalHandleCacheSize > 0 && !CheckJNICalls;
+}
+
+oop* JNIHandles::allocate_global_entry() {
+  Thread* thread = Thread::current_or_null();
+  if (!use_global_handle_cache() || thread == nullptr || !thread->is_Java_thread()) {
+    return global_handles()->allocate();
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  oop** cache = jt->cached_global_handles();
+  if (cache == nullptr) {
+    cache = NEW_C_HEAP_ARRAY(oop*, JNIGlobalHandleCacheSize, mtInternal);
+    jt->set_cached_global_handles(cache);
+  }
+  uint count = jt->cached_global_handles_count();
+  if (count == 0) {
+    count = checked_cast<uint>(global_handles()->allocate(cache, JNIGlobalHandleCacheSize));
+    if (count == 0) {
+      return nullptr;
+    }
+  }
+  jt->set_cached_global_handles_count(count - 1);
+  return cache[count - 1];
+}
+
+void JNIHandles::release_global_entry(oop* ptr) {
+  Thread* thread = Thread::current_or_null();
+  if (use_global_handle_cache() && thread != nullptr && thread->is_Java_thread()) {
+    JavaThread* jt = JavaThread::cast(thread);
+    uint count = jt->cached_global_handles_count();
+    if (jt->cached_global_handles() != nullptr && count < JNIGlobalHandleCacheSize) {
+      jt->cached_global_handles()[count] = ptr;
+      jt->set_cached_global_handles_count(count + 1);
+      return;
+    }
+  }
+  global_handles()->release(ptr);
+}
+
+// Cached entries are allocated in the global handle storage, so they are
+// included in its allocation_count(), but they do not hold a global ref.
+size_t JNIHandles::cached_global_handle_count() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  size_t count = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    count += jt->cached_global_handles_count();
+  }
+  return count;
+}
+
+void JNIHandles::release_cached_global_handles(JavaThread* thread) {
+  oop** cache = thread->cached_global_handles();
+  if (cache != nullptr) {
+    global_handles()->release(cache, thread->cached_global_handles_count());
+    thread->set_cached_global_handles_count(0);
+    thread->set_cached_global_handles(nullptr);
+    FREE_C_HEAP_ARRAY(oop*, cache);
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_stw_gc_active(), "can't extend the root set during GC pause");
   assert(!current_thread_in_native(), "must not be in native");
@@ -88,7 +156,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_entry();
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -147,7 +215,7 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    release_global_entry(oop_ptr);
   }
 }
 
@@ -251,7 +319,7 @@ void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
   st->print_cr("JNI global refs: %zu, weak refs: %zu",
-               global_handles()->allocation_count(),
+               global_handles()->allocation_count() - cached_global_handle_count(),
                weak_global_handles()->allocation_count());
   st->cr();
   st->flush();
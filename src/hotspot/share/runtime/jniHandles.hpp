@@ -52,6 +52,13 @@ class JNIHandles : AllStatic {
   inline static oop* global_ptr(jobject handle);
   inline static oop* weak_global_ptr(jweak handle);
 
+  // Allocation and release of global handle entries, going through the
+  // current thread's cache if JNIGlobalHandleCacheSize is set.
+  static bool use_global_handle_cache();
+  static oop* allocate_global_entry();
+  static void release_global_entry(oop* ptr);
+  static size_t cached_global_handle_count();
+
   template <DecoratorSet decorators, bool external_guard> inline static oop resolve_impl(jobject handle);
 
   // Resolve handle into oop, without keeping the object alive
@@ -101,6 +108,8 @@ class JNIHandles : AllStatic {
   static jobject make_global(Handle  obj,
                              AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void destroy_global(jobject handle);
+  // Releases the global handle entries cached by thread.
+  static void release_cached_global_handles(JavaThread* thread);
 
   // Weak global handles
   static jweak make_weak_global(Handle obj,
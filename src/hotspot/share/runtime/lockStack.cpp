@@ -117,7 +117,8 @@ void LockStack::print_on(outputStream* st) {
   }
 }
 
-OMCache::OMCache(JavaThread* jt) : _entries() {
+OMCache::OMCache(JavaThread* jt) : _entries(), _capacity(ObjectMonitorTableCacheSize) {
+  assert(0 < _capacity && _capacity <= CAPACITY, "invalid capacity %d", _capacity);
   STATIC_ASSERT(std::is_standard_layout<OMCache>::value);
   STATIC_ASSERT(std::is_standard_layout<OMCache::OMCacheEntry>::value);
   STATIC_ASSERT(offsetof(OMCache, _null_sentinel) == offsetof(OMCache, _entries) +
@@ -132,7 +132,10 @@ class LockStack {
 class OMCache {
   friend class VMStructs;
  public:
-  static constexpr int CAPACITY = 8;
+  // Maximum number of entries, the number in use is given by
+  // ObjectMonitorTableCacheSize. Unused entries stay null, which ends
+  // the search done by the compiled fast paths.
+  static constexpr int CAPACITY = 16;
 
  private:
   struct OMCacheEntry {
@@ -140,6 +143,7 @@ class OMCache {
     ObjectMonitor* _monitor = nullptr;
   } _entries[CAPACITY];
   const oop _null_sentinel = nullptr;
+  const int _capacity;
 
  public:
   static ByteSize entries_offset() { return byte_offset_of(OMCache, _entries); }
@@ -250,7 +250,7 @@ inline void LockStack::oops_do(OopClosure* cl) {
 }
 
 inline void OMCache::set_monitor(ObjectMonitor *monitor) {
-  const int end = OMCache::CAPACITY - 1;
+  const int end = _capacity - 1;
 
   oop obj = monitor->object_peek();
   assert(obj != nullptr, "must be alive");
@@ -273,13 +273,13 @@ inline void OMCache::set_monitor(ObjectMonitor *monitor) {
 }
 
 inline ObjectMonitor* OMCache::get_monitor(oop o) {
-  for (int i = 0; i < CAPACITY; ++i) {
+  for (int i = 0; i < _capacity; ++i) {
     if (_entries[i]._oop == o) {
       assert(_entries[i]._monitor != nullptr, "monitor must exist");
       if (_entries[i]._monitor->is_being_async_deflated()) {
         // Bad monitor
         // Shift down rest
-        for (; i < CAPACITY - 1; ++i) {
+        for (; i < _capacity - 1; ++i) {
           _entries[i] = _entries[i + 1];
         }
         // Clear end
@@ -107,6 +107,7 @@ Mutex*   FreeList_lock                = nullptr;
 Mutex*   OldSets_lock                 = nullptr;
 Mutex*   Uncommit_lock                = nullptr;
 Monitor* RootRegionScan_lock          = nullptr;
+Monitor* G1ClassUnloadingPurge_lock   = nullptr;
 
 Mutex*   Management_lock              = nullptr;
 Monitor* MonitorDeflation_lock        = nullptr;
@@ -218,6 +219,7 @@ void mutex_init() {
     MUTEX_DEFN(OldSets_lock                  , PaddedMutex  , nosafepoint);
     MUTEX_DEFN(Uncommit_lock                 , PaddedMutex  , service-2);
     MUTEX_DEFN(RootRegionScan_lock           , PaddedMonitor, nosafepoint-1);
+    MUTEX_DEFN(G1ClassUnloadingPurge_lock    , PaddedMonitor, nosafepoint);
 
     MUTEX_DEFN(MarkStackFreeList_lock        , PaddedMutex  , nosafepoint);
     MUTEX_DEFN(MarkStackChunkList_lock       , PaddedMutex  , nosafepoint);
@@ -2553,7 +2553,10 @@ inline void ObjectMonitor::dequeue_specific_waiter(ObjectWaiter* node) {
 void ObjectMonitor::Initialize() {
   assert(!InitDone, "invariant");
 
-  if (!os::is_MP()) {
+  // Spinning cannot succeed if the owner is not running at the same time,
+  // which is also the case when a container limits us to a single CPU
+  // even though the host has more.
+  if (!os::is_MP() || os::active_processor_count() == 1) {
     Knob_SpinLimit = 0;
     Knob_PreSpin   = 0;
     Knob_FixedSpin = -1;
@@ -624,7 +624,7 @@ static void break_if_ptr_caught(void* ptr) {
 #endif // ASSERT
 
 void* os::malloc(size_t size, MemTag mem_tag) {
-  return os::malloc(size, mem_tag, CALLER_PC);
+  return os::malloc(size, mem_tag, MALLOC_CALLER_PC);
 }
 
 void* os::malloc(size_t size, MemTag mem_tag, const NativeCallStack& stack) {
@@ -674,7 +674,7 @@ void* os::malloc(size_t size, MemTag mem_tag, const NativeCallStack& stack) {
 }
 
 void* os::realloc(void *memblock, size_t size, MemTag mem_tag) {
-  return os::realloc(memblock, size, mem_tag, CALLER_PC);
+  return os::realloc(memblock, size, mem_tag, MALLOC_CALLER_PC);
 }
 
 void* os::realloc(void *memblock, size_t size, MemTag mem_tag, const NativeCallStack& stack) {
@@ -1641,17 +1641,29 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* locking_thread, oop
 }
 
 // Walk the in-use list and deflate (at most MonitorDeflationMax) idle
-// ObjectMonitors. Returns the number of deflated ObjectMonitors.
+// ObjectMonitors. Returns the number of deflated ObjectMonitors. If
+// MonitorDeflationMaxTime is set, the walk also stops once that time has
+// passed, and time_limit_reached is set.
 //
-size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer) {
+size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer, bool* time_limit_reached) {
   MonitorList::Iterator iter = _in_use_list.iterator();
   size_t deflated_count = 0;
+  size_t visited_count = 0;
   Thread* current = Thread::current();
+  const jlong deadline_ns = MonitorDeflationMaxTime > 0
+                          ? os::javaTimeNanos() + (jlong)MonitorDeflationMaxTime * NANOSECS_PER_MILLISEC
+                          : 0;
+  *time_limit_reached = false;
 
   while (iter.has_next()) {
     if (deflated_count >= (size_t)MonitorDeflationMax) {
       break;
     }
+    // Reading the clock is too expensive to do for every monitor.
+    if (deadline_ns != 0 && (++visited_count % 1024) == 0 && os::javaTimeNanos() > deadline_ns) {
+      *time_limit_reached = true;
+      break;
+    }
     ObjectMonitor* mid = iter.next();
     if (mid->deflate_monitor(current)) {
       deflated_count++;
@@ -1812,7 +1824,8 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   log.begin();
 
   // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(&safepointer);
+  bool time_limit_reached;
+  size_t deflated_count = deflate_monitor_list(&safepointer, &time_limit_reached);
 
   // Unlink the deflated ObjectMonitors from the in-use list.
   size_t unlinked_count = 0;
@@ -1854,6 +1867,13 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   log.end(deflated_count, unlinked_count);
 
+  if (time_limit_reached) {
+    // Continue with the rest of the in-use list in the next cycle.
+    log_info(monitorinflation)("Async deflation stopped after MonitorDeflationMaxTime (%zu ms)",
+                               MonitorDeflationMaxTime);
+    set_is_async_deflation_requested(true);
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
@@ -187,7 +187,7 @@ class ObjectSynchronizer : AllStatic {
   static size_t deflate_idle_monitors();
 
   // Deflate idle monitors:
-  static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer);
+  static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer, bool* time_limit_reached);
   static size_t in_use_list_count();
   static size_t in_use_list_max();
   static size_t in_use_list_ceiling();
@@ -137,6 +137,10 @@ uint                  ThreadsSMRSupport::_to_delete_list_cnt = 0;
 // Impl note: See _to_delete_list_cnt note.
 uint                  ThreadsSMRSupport::_to_delete_list_max = 0;
 
+// # of ThreadsLists added to the to-delete list since the last hazard ptr
+// scan, see ThreadSMRFreeListBatchSize.
+uint                  ThreadsSMRSupport::_to_delete_list_unscanned_cnt = 0;
+
 // 'inline' functions first so the definitions are before first use:
 
 inline void ThreadsSMRSupport::add_deleted_thread_times(uint add_value) {
@@ -909,6 +913,15 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  // Scanning the hazard ptrs of all threads dominates the cost of adding
+  // and removing threads when there are many of them, so optionally
+  // collect a few retired ThreadsLists and free them together.
+  if (++_to_delete_list_unscanned_cnt < ThreadSMRFreeListBatchSize) {
+    log_debug(thread, smr)("tid=%zu: ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+  _to_delete_list_unscanned_cnt = 0;
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
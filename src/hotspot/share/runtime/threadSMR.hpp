@@ -121,6 +121,7 @@ class ThreadsSMRSupport : AllStatic {
   static ThreadsList*          _to_delete_list;
   static uint                  _to_delete_list_cnt;
   static uint                  _to_delete_list_max;
+  static uint                  _to_delete_list_unscanned_cnt;
 
   static void add_deleted_thread_times(uint add_value);
   static void add_tlh_times(uint add_value);
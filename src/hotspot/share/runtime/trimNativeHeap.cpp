@@ -50,6 +50,10 @@ class NativeHeapTrimmerThread : public NamedThread {
   bool _stop;
   uint16_t _suspend_count;
 
+  // Current multiple of TrimNativeHeapInterval to wait before the next trim;
+  // grows up to TrimNativeHeapMaxBackoff while trims don't free anything.
+  uint _backoff;
+
   // Statistics
   uint64_t _num_trims_performed;
 
@@ -94,7 +98,7 @@ class NativeHeapTrimmerThread : public NamedThread {
 
     while (true) {
       double tnow = now();
-      double next_trim_time = tnow + interval_secs;
+      double next_trim_time = tnow + interval_secs * _backoff;
 
       unsigned times_suspended = 0;
       unsigned times_waited = 0;
@@ -138,10 +142,14 @@ class NativeHeapTrimmerThread : public NamedThread {
     os::size_change_t sc = { 0, 0 };
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
+    const bool adaptive = TrimNativeHeapMaxBackoff > 1;
 
-    // We only collect size change information if we are logging; save the access to procfs otherwise.
-    if (os::trim_native_heap(logging_enabled ? &sc : nullptr)) {
+    // We only collect size change information if we need it; save the access to procfs otherwise.
+    if (os::trim_native_heap((logging_enabled || adaptive) ? &sc : nullptr)) {
       _num_trims_performed++;
+      if (adaptive && sc.after != SIZE_MAX) {
+        update_backoff(sc.after < sc.before);
+      }
       if (logging_enabled) {
         double t2 = now();
         if (sc.after != SIZE_MAX) {
@@ -160,12 +168,27 @@ class NativeHeapTrimmerThread : public NamedThread {
     }
   }
 
+  // Double the wait after a trim that freed nothing, go back to the
+  // configured interval as soon as a trim pays off again.
+  void update_backoff(bool freed_memory) {
+    const uint old_backoff = _backoff;
+    if (freed_memory) {
+      _backoff = 1;
+    } else {
+      _backoff = MIN2(_backoff * 2, TrimNativeHeapMaxBackoff);
+    }
+    if (_backoff != old_backoff) {
+      log_debug(trimnative)("Trim interval now " UINT64_FORMAT " ms", (uint64_t)TrimNativeHeapInterval * _backoff);
+    }
+  }
+
 public:
 
   NativeHeapTrimmerThread() :
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
+    _backoff(1),
     _num_trims_performed(0)
   {
     set_name("Native Heap Trimmer");
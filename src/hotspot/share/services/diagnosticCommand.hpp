@@ -535,6 +535,22 @@ class CodeCacheDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class CompilerPerfDCmd : public DCmd {
+public:
+  CompilerPerfDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "Compiler.perf";
+  }
+  static const char* description() {
+    return "Print accumulated compilation times per compiler, tier and compiler phase. "
+           "The times are only collected with -XX:+CITime.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 //---<  BEGIN  >--- CodeHeap State Analytics.
 class CodeHeapAnalyticsDCmd : public DCmdWithParser {
 protected:
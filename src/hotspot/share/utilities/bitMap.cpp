@@ -637,11 +637,33 @@ void BitMap::clear_large() {
   clear_large_range_of_words(0, size_in_words());
 }
 
+// Same algorithm as population_count(), but the per-byte counts of up to
+// 31 words are accumulated before they are summed up, which saves the
+// final horizontal sum for all but one word in each group.
 BitMap::idx_t BitMap::count_one_bits_in_range_of_words(idx_t beg_full_word, idx_t end_full_word) const {
+  const bm_word_t all = ~bm_word_t(0);
+  const bm_word_t fives = all / 3;              // 0x55..55
+  const bm_word_t threes = (all / 15) * 3;      // 0x33..33
+  const bm_word_t z_effs = (all / 255) * 15;    // 0x0F0F..0F
+  const bm_word_t z_ffs = (all / 0xFFFF) * 255; // 0x00FF00FF..00FF
+  const bm_word_t h_ones = all / 0xFFFF;        // 0x00010001..0001
+  // Each byte of a word counts at most 8 bits, a byte accumulator holds 255.
+  const idx_t words_per_group = 255 / BitsPerByte;
+
   idx_t sum = 0;
-  for (idx_t i = beg_full_word; i < end_full_word; i++) {
-    bm_word_t w = map()[i];
-    sum += population_count(w);
+  idx_t i = beg_full_word;
+  while (i < end_full_word) {
+    const idx_t group_end = MIN2(end_full_word, i + words_per_group);
+    bm_word_t bytes = 0;
+    for (; i < group_end; i++) {
+      bm_word_t r = map()[i];
+      r -= ((r >> 1) & fives);
+      r = (r & threes) + ((r >> 2) & threes);
+      bytes += (r + (r >> 4)) & z_effs;
+    }
+    // Add pairs of bytes into 16-bit lanes, then sum the lanes.
+    const bm_word_t lanes = (bytes & z_ffs) + ((bytes >> 8) & z_ffs);
+    sum += (lanes * h_ones) >> (BitsPerWord - 16);
   }
   return sum;
 }
@@ -173,11 +173,15 @@ class FormatStringEventLog : public EventLogBase< FormatStringLogMessage<bufsz>
     if (!this->should_log()) return;
 
     double timestamp = this->fetch_timestamp();
+    // Format before taking the lock, so that concurrent loggers only
+    // serialize on the copy into the ring buffer.
+    char msg[bufsz];
+    jio_vsnprintf(msg, bufsz, format, ap);
     MutexLocker ml(&this->_mutex, Mutex::_no_safepoint_check_flag);
     int index = this->compute_log_index();
     this->_records[index].thread = thread;
     this->_records[index].timestamp = timestamp;
-    this->_records[index].data.printv(format, ap);
+    memcpy(this->_records[index].data.buffer(), msg, strlen(msg) + 1);
   }
 
   void log(Thread* thread, const char* format, ...) ATTRIBUTE_PRINTF(3, 4) {
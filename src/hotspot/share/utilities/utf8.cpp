@@ -97,6 +97,13 @@ char* UTF8::next_character(const char* str, jint* value) {
   return next_ch;
 }
 
+// Returns true if none of the 8 bytes at str has its high bit set
+static inline bool is_ascii_word(const char* str) {
+  uint64_t word;
+  memcpy(&word, str, sizeof(word));
+  return (word & UCONST64(0x8080808080808080)) == 0;
+}
+
 // The number of unicode characters in a utf8 sequence can be easily
 // determined by noting that bytes of the form 10xxxxxx are part of
 // a 2 or 3-byte multi-byte sequence, all others are either characters
@@ -111,7 +118,13 @@ int UTF8::unicode_length(const char* str, size_t len, bool& is_latin1, bool& has
   has_multibyte = false;
   is_latin1 = true;
   unsigned char prev = 0;
-  for (size_t i = 0; i < len; i++) {
+  size_t i = 0;
+  // Skip over all-ASCII words, which contain no continuation bytes
+  while (i + sizeof(uint64_t) <= len && is_ascii_word(str + i)) {
+    i += sizeof(uint64_t);
+    prev = str[i - 1];
+  }
+  for (; i < len; i++) {
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -182,6 +195,15 @@ template<typename T> void UTF8::convert_to_unicode(const char* utf8_str, T* unic
   int index = 0;
 
   /* ASCII case loop optimization */
+  // Convert 8 bytes at a time while they are all ASCII. Every character
+  // is at least one byte, so the bytes read are within the string.
+  while (index + (int)sizeof(uint64_t) <= unicode_length && is_ascii_word(ptr)) {
+    for (size_t i = 0; i < sizeof(uint64_t); i++) {
+      unicode_str[index + i] = (T)(unsigned char)ptr[i];
+    }
+    index += sizeof(uint64_t);
+    ptr += sizeof(uint64_t);
+  }
   for (; index < unicode_length; index++) {
     if((ch = ptr[0]) > 0x7F) { break; }
     unicode_str[index] = (T)ch;
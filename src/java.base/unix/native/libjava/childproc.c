@@ -32,6 +32,9 @@
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #include "childproc.h"
 #include "jni_util.h"
@@ -82,6 +85,15 @@ isAsciiDigit(char c)
   #define FD_DIR "/proc/self/fd"
 #endif
 
+#if defined(__linux__)
+  #ifndef SYS_close_range
+    #define SYS_close_range 436
+  #endif
+  #ifndef CLOSE_RANGE_CLOEXEC
+    #define CLOSE_RANGE_CLOEXEC (1U << 2)
+  #endif
+#endif
+
 static int
 markDescriptorsCloseOnExec(void)
 {
@@ -99,6 +111,13 @@ markDescriptorsCloseOnExec(void)
     snprintf(aix_fd_dir, 32, "/proc/%d/fd", getpid());
 #endif
 
+#if defined(__linux__)
+    /* Since Linux 5.11 a single close_range(2) call can do this. On older
+     * kernels it fails with ENOSYS or EINVAL and we walk FD_DIR instead. */
+    if (syscall(SYS_close_range, fd_from, ~0U, CLOSE_RANGE_CLOEXEC) == 0)
+        return 0;
+#endif
+
     if ((dp = opendir(FD_DIR)) == NULL)
         return -1;
 
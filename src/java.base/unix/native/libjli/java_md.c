@@ -517,6 +517,24 @@ GetJDKInstallRoot(char *path, jint pathsize, jboolean speculative)
     return JNI_FALSE;
 }
 
+#ifdef __linux__
+/*
+ * Start asynchronous readahead of a file that is about to be mapped, so
+ * that on a cold page cache the page faults don't each wait for a small
+ * read. Failures are ignored, this is only a hint.
+ */
+static void
+PrefetchFile(const char *path)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        JLI_TraceLauncher("Prefetching %s\n", path);
+        (void) posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        close(fd);
+    }
+}
+#endif
+
 jboolean
 LoadJavaVM(const char *jvmpath, InvocationFunctions *ifn)
 {
@@ -527,6 +545,15 @@ LoadJavaVM(const char *jvmpath, InvocationFunctions *ifn)
     if (JLI_IsStaticallyLinked()) {
         libjvm = dlopen(NULL, RTLD_NOW + RTLD_GLOBAL);
     } else {
+#ifdef __linux__
+        /*
+         * Only libjvm is prefetched. Which CDS archive the VM maps, if any,
+         * depends on options (-Xshare, UseCompressedOops,
+         * UseCompactObjectHeaders) that may come from sources the launcher
+         * does not see, such as JAVA_TOOL_OPTIONS or -XX:Flags files.
+         */
+        PrefetchFile(jvmpath);
+#endif
         libjvm = dlopen(jvmpath, RTLD_NOW + RTLD_GLOBAL);
         if (libjvm == NULL) {
             JLI_ReportErrorMessage(DLL_ERROR1, __LINE__);
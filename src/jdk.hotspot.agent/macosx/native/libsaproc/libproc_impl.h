@@ -202,6 +202,7 @@ struct core_data {
    // part of the class sharing workaround
    map_info*          class_share_maps;// class share maps in a linked list
    map_info**         map_array; // sorted (by vaddr) array of map_info pointers
+   map_info*          last_map;  // map_array entry found by the last core_lookup
    char               exec_path[4096];  // file name java
 };
 
@@ -174,6 +174,12 @@ map_info* core_lookup(struct ps_prochandle *ph, uintptr_t addr) {
   int mid, lo = 0, hi = ph->core->num_maps - 1;
   map_info *mp;
 
+  // Reads mostly come in runs within one mapping, so try the last hit first.
+  mp = ph->core->last_map;
+  if (mp != NULL && addr >= mp->vaddr && addr < mp->vaddr + mp->memsz) {
+    return (mp);
+  }
+
   while (hi - lo > 1) {
     mid = (lo + hi) / 2;
     if (addr >= ph->core->map_array[mid]->vaddr) {
@@ -190,6 +196,7 @@ map_info* core_lookup(struct ps_prochandle *ph, uintptr_t addr) {
   }
 
   if (addr >= mp->vaddr && addr < mp->vaddr + mp->memsz) {
+    ph->core->last_map = mp;
     return (mp);
   }
 
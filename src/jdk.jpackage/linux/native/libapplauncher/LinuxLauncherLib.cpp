@@ -46,6 +46,23 @@ size_t hash(const std::string& str) {
 
 Jvm* jvmLauncher;
 
+// Returns per-user cache directory of the application following
+// XDG Base Directory specification, or empty string if neither
+// XDG_CACHE_HOME nor HOME environment variable is set.
+tstring getCacheDir(const tstring& appName) {
+    tstring cacheHome = SysInfo::getEnvVariable(std::nothrow,
+            "XDG_CACHE_HOME", "");
+    if (cacheHome.empty()) {
+        const tstring homeDir = SysInfo::getEnvVariable(std::nothrow,
+                "HOME", "");
+        if (homeDir.empty()) {
+            return tstring();
+        }
+        cacheHome = FileUtils::mkpath() << homeDir << ".cache";
+    }
+    return FileUtils::mkpath() << cacheHome << appName;
+}
+
 void launchApp() {
     const tstring launcherPath = SysInfo::getProcessModulePath();
 
@@ -64,11 +81,13 @@ void launchApp() {
         appLauncher
             .setImageRoot(appImageRoot)
             .setAppDir(FileUtils::mkpath() << appImageRoot << _T("lib/app"))
+            .setCacheDir(getCacheDir(FileUtils::basename(launcherPath)))
             .setLibEnvVariableName(_T("LD_LIBRARY_PATH"))
             .setDefaultRuntimePath(FileUtils::mkpath() << appImageRoot
                     << _T("lib/runtime"));
     } else {
         ownerPackage.initAppLauncher(appLauncher);
+        appLauncher.setCacheDir(getCacheDir(ownerPackage.name()));
 
         tstring homeDir;
         JP_TRY;
@@ -125,6 +125,24 @@ Jvm* AppLauncher::createJvmLauncher() const {
                 PropertyName::arguments, args);
     }
 
+    // Options from the AppCDSJavaOptions section typically point the JVM
+    // at a CDS archive in $CACHEDIR, for example with
+    // -XX:+AutoCreateSharedArchive -XX:SharedArchiveFile=$CACHEDIR/app.jsa.
+    // The JVM creates the archive on the first run and recreates it when
+    // it no longer matches the runtime or the application jars, but it
+    // doesn't create the directory.
+    if (!cfgFile.getProperties(SectionName::AppCDSJavaOptions).empty()) {
+        if (cacheDirPath.empty()
+                || !FileUtils::createDirectories(cacheDirPath, std::nothrow)) {
+            LOG_WARNING(tstrings::any()
+                    << "Options from \"" << SectionName::AppCDSJavaOptions.name()
+                    << "\" section ignored. Cache directory \""
+                    << cacheDirPath << "\" not available");
+            cfgFile.setPropertyValue(SectionName::AppCDSJavaOptions,
+                    PropertyName::javaOptions, tstring_array());
+        }
+    }
+
     std::unique_ptr<Jvm> jvm(new Jvm());
 
     if (!libEnvVariableContainsAppDir()) {
@@ -167,6 +185,9 @@ CfgFile* AppLauncher::createCfgFile() const {
     macros[_T("APPDIR")] = appDirPath;
     macros[_T("BINDIR")] = FileUtils::dirname(launcherPath);
     macros[_T("ROOTDIR")] = imageRoot;
+    if (!cacheDirPath.empty()) {
+        macros[_T("CACHEDIR")] = cacheDirPath;
+    }
     std::unique_ptr<CfgFile> dummy(new CfgFile());
     CfgFile::load(cfgFilePath).expandMacros(macros).swap(*dummy);
     return dummy.release();
@@ -56,6 +56,11 @@ class AppLauncher {
         return *this;
     }
 
+    AppLauncher& setCacheDir(const tstring& v) {
+        cacheDirPath = v;
+        return *this;
+    }
+
     AppLauncher& setLibEnvVariableName(const tstring& v) {
         libEnvVarName = v;
         return *this;
@@ -92,6 +97,7 @@ class AppLauncher {
     tstring launcherPath;
     tstring defaultRuntimePath;
     tstring appDirPath;
+    tstring cacheDirPath;
     tstring libEnvVarName;
     tstring imageRoot;
     tstring_array jvmLibNames;
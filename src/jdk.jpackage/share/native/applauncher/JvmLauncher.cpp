@@ -85,9 +85,13 @@ Jvm& Jvm::initFromConfigFile(const CfgFile& cfgFile) {
         }
     }
 
-    {
+    const CfgFile::SectionName javaOptionsSections[] = {
+        SectionName::JavaOptions,
+        SectionName::AppCDSJavaOptions
+    };
+    for (size_t i = 0; i < sizeof(javaOptionsSections) / sizeof(javaOptionsSections[0]); ++i) {
         const CfgFile::Properties& section = cfgFile.getProperties(
-                SectionName::JavaOptions);
+                javaOptionsSections[i]);
         const CfgFile::Properties::const_iterator javaOptions = section.find(
                 PropertyName::javaOptions);
         if (javaOptions != section.end()) {
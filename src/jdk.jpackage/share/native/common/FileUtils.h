@@ -122,6 +122,10 @@ namespace FileUtils {
     // it contains at least one file other than "." or "..".
     bool isDirectoryNotEmpty(const tstring &dirPath);
 
+    // creates the specified directory and all missing parent directories
+    // returns true if the directory exists when the function returns
+    bool createDirectories(const tstring &dirPath, const std::nothrow_t&);
+
 } // FileUtils
 
 #endif // FILEUTILS_H
@@ -24,11 +24,13 @@
  */
 
 
+#include <errno.h>
 #include <limits.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "FileUtils.h"
 #include "ErrorHandling.h"
+#include "Log.h"
 
 
 namespace FileUtils {
@@ -67,4 +69,32 @@ tstring stripExeSuffix(const tstring& path) {
     return path;
 }
 
+namespace {
+
+bool isExistingDirectory(const tstring &path) {
+    struct stat statBuffer;
+    return stat(path.c_str(), &statBuffer) == 0 && S_ISDIR(statBuffer.st_mode);
+}
+
+} // namespace
+
+bool createDirectories(const tstring &dirPath, const std::nothrow_t&) {
+    if (dirPath.empty() || isExistingDirectory(dirPath)) {
+        return !dirPath.empty();
+    }
+
+    const tstring parentDir = dirname(dirPath);
+    if (!parentDir.empty() && parentDir != dirPath
+            && !createDirectories(parentDir, std::nothrow)) {
+        return false;
+    }
+
+    if (mkdir(dirPath.c_str(), 0700) != 0 && errno != EEXIST) {
+        LOG_TRACE(tstrings::any() << "mkdir(" << dirPath
+                << ") failed. Error: " << lastCRTError());
+        return false;
+    }
+    return isExistingDirectory(dirPath);
+}
+
 } //  namespace FileUtils
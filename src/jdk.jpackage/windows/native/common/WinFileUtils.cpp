@@ -198,6 +198,15 @@ void createDirectory(const tstring &path, tstring_array* createdDirs) {
     }
 }
 
+bool createDirectories(const tstring &dirPath, const std::nothrow_t&) {
+    JP_TRY;
+    createDirectory(dirPath);
+    return true;
+    JP_CATCH_ALL;
+
+    return false;
+}
+
 
 void copyFile(const tstring& fromPath, const tstring& toPath,
         bool failIfExists) {
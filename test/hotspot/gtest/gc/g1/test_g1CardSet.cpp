@@ -485,3 +485,24 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, coarsen_thresholds_test) {
+  const uint CardsPerRegion = 2048;
+
+  G1CardSetConfiguration config(28,
+                                0.9 /* cards_in_bitmap_threshold_percent */,
+                                8,
+                                0.8 /* cards_in_howl_threshold_percent */,
+                                CardsPerRegion,
+                                0);
+
+  ASSERT_EQ(config.cards_in_howl_threshold(), (uint)(CardsPerRegion * 0.8));
+  ASSERT_EQ(config.cards_in_howl_bitmap_threshold(), (uint)(config.max_cards_in_howl_bitmap() * 0.9));
+
+  config.set_coarsen_thresholds_percent(0.5, 1.0);
+
+  ASSERT_EQ(config.cards_in_howl_threshold(), CardsPerRegion);
+  ASSERT_EQ(config.cards_in_howl_bitmap_threshold(), config.max_cards_in_howl_bitmap() / 2);
+  ASSERT_EQ(config.cards_in_howl_threshold_percent(), 1.0);
+  ASSERT_EQ(config.cards_in_howl_bitmap_threshold_percent(), 0.5);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "microBenchmark.inline.hpp"
+#include "unittest.hpp"
+
+// Baseline microbenchmarks for GC support data structures, see
+// microBenchmark.inline.hpp for how to run them.
+
+typedef GenericTaskQueue<uintptr_t, mtTest> BenchTaskQueue;
+
+static volatile uintptr_t _gc_bench_sink = 0;
+
+BENCH_VM(TaskQueue, push_pop_local) {
+  BenchTaskQueue* queue = new BenchTaskQueue();
+  // Push and pop in batches of half the queue, as a worker draining its
+  // own queue does.
+  auto body = [&](Thread* thread, int id, size_t ops) {
+    const size_t batch = queue->max_elems() / 2;
+    uintptr_t sum = 0;
+    for (size_t done = 0; done < ops; done += batch) {
+      const size_t n = MIN2(batch, ops - done);
+      for (size_t i = 0; i < n; i++) {
+        queue->push(i);
+      }
+      uintptr_t t;
+      while (queue->pop_local(t)) {
+        sum += t;
+      }
+    }
+    Atomic::add(&_gc_bench_sink, sum);
+  };
+  MicroBenchmark::run("GenericTaskQueue::push+pop_local", body, 1 * M);
+  delete queue;
+}
+
+BENCH_VM(TaskQueue, steal) {
+  // All threads steal from a single queue.
+  const int threads = MAX2(2, MIN2(8, os::processor_count()));
+  BenchTaskQueue* queue = new BenchTaskQueue();
+  auto body = [&](Thread* thread, int id, size_t ops) {
+    uintptr_t stolen = 0;
+    for (size_t i = 0; i < ops; i++) {
+      uintptr_t t;
+      if (queue->pop_global(t) == BenchTaskQueue::PopResult::Success) {
+        stolen++;
+      }
+    }
+    Atomic::add(&_gc_bench_sink, stolen);
+  };
+  // Fill the queue once, with enough elements for the steals of all rounds,
+  // so that the stealers never find it empty.
+  const size_t steal_ops = 1 * K;
+  const size_t needed = threads * steal_ops *
+    (MicroBenchmark::default_warmup_rounds + MicroBenchmark::default_rounds);
+  ASSERT_LE(needed, (size_t)queue->max_elems());
+  for (size_t i = 0; i < needed; i++) {
+    queue->push(i);
+  }
+  MicroBenchmark::run("GenericTaskQueue::pop_global", body, steal_ops, threads);
+  delete queue;
+}
+
+BENCH_VM(OopStorage, allocate_release) {
+  const size_t batch = 1024;
+  OopStorage* storage = OopStorage::create("Bench Storage", mtGC);
+  auto body = [&](Thread* thread, int id, size_t ops) {
+    oop* entries[batch];
+    for (size_t done = 0; done < ops; done += batch) {
+      const size_t n = MIN2(batch, ops - done);
+      for (size_t i = 0; i < n; i++) {
+        entries[i] = storage->allocate();
+      }
+      storage->release(entries, n);
+    }
+  };
+  MicroBenchmark::run("OopStorage::allocate+release", body, 256 * K,
+                      MAX2(1, MIN2(4, os::processor_count())));
+  delete storage;
+}
@@ -76,3 +76,33 @@ TEST(PartialArrayTaskStepperTest, doit) {
     }
   }
 }
+
+static void run_bounded_test(size_t length, size_t chunk_size, uint n_workers, uint max_chunks_per_worker) {
+  const PartialArrayTaskStepper stepper(n_workers, chunk_size, max_chunks_per_worker);
+  const size_t actual_chunk_size = stepper.chunk_size(length);
+  ASSERT_EQ(actual_chunk_size % chunk_size, 0u);
+  ASSERT_LE(length / actual_chunk_size, size_t(n_workers) * max_chunks_per_worker + 1);
+  size_t to_length;
+  uint tasks = simulate(&stepper, length, &to_length);
+  ASSERT_EQ(length, to_length);
+  ASSERT_EQ(tasks, length / actual_chunk_size);
+}
+
+TEST(PartialArrayTaskStepperTest, bounded_chunks) {
+  for (size_t chunk_size = 50; chunk_size <= 500; chunk_size += 150) {
+    for (uint n_workers = 1; n_workers <= 256; n_workers = (n_workers * 3 / 2 + 1)) {
+      for (uint max_chunks_per_worker = 1; max_chunks_per_worker <= 64; max_chunks_per_worker *= 4) {
+        for (size_t length = 0; length <= 10000000; length = (length * 2 + 1)) {
+          run_bounded_test(length, chunk_size, n_workers, max_chunks_per_worker);
+        }
+      }
+    }
+  }
+}
+
+TEST(PartialArrayTaskStepperTest, small_arrays_unchanged) {
+  const PartialArrayTaskStepper stepper(8, 50, 4);
+  ASSERT_EQ(stepper.chunk_size(0), 50u);
+  ASSERT_EQ(stepper.chunk_size(8 * 4 * 50), 50u);
+  ASSERT_EQ(stepper.chunk_size(8 * 4 * 50 + 50), 100u);
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef GTEST_MICROBENCHMARK_INLINE_HPP
+#define GTEST_MICROBENCHMARK_INLINE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/semaphore.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "utilities/ticks.hpp"
+
+// Helpers for native microbenchmarks of VM-internal code, so that data
+// structures can be compared without building and running JMH.
+//
+// A benchmark is declared with BENCH_VM(category, name). It is an ordinary
+// TEST_VM with a DISABLED_bench_ prefix, so normal gtest runs skip it. Run
+// benchmarks explicitly with
+//
+//   --gtest_also_run_disabled_tests --gtest_filter='*bench_*'
+//
+// The body calls MicroBenchmark::run() with a callable F of signature
+// void(Thread*, int, size_t). F gets the current thread, a thread id in
+// [0, threads), and the number of operations to perform. Every thread runs
+// F once per round, with all threads started together. After the warmup
+// rounds, the time per operation of each measured round is recorded, and
+// the minimum, median and maximum are printed.
+#define BENCH_VM(category, name) TEST_VM(category, CONCAT(DISABLED_bench_, name))
+
+class MicroBenchmark : AllStatic {
+  template<typename F>
+  class BenchThread : public JavaTestThread {
+    F& _fun;
+    const int _id;
+    const size_t _ops;
+    const int _rounds;
+    Semaphore* _start;
+    Semaphore* _round_done;
+
+  public:
+    BenchThread(F& fun, int id, size_t ops, int rounds,
+                Semaphore* start, Semaphore* round_done, Semaphore* exited)
+      : JavaTestThread(exited),
+        _fun(fun), _id(id), _ops(ops), _rounds(rounds),
+        _start(start), _round_done(round_done) {}
+
+    virtual ~BenchThread() {}
+
+    void main_run() override {
+      for (int r = 0; r < _rounds; r++) {
+        _start->wait();
+        _fun(this, _id, _ops);
+        _round_done->signal();
+      }
+    }
+  };
+
+  static int compare_double(double a, double b) {
+    return a < b ? -1 : (a > b ? 1 : 0);
+  }
+
+  static void report(const char* name, int threads, size_t ops, double* ns_per_op, int rounds) {
+    QuickSort::sort(ns_per_op, rounds, compare_double);
+    tty->print_cr("[bench] %s: threads=%d ops/thread=%zu ns/op min=%.2f median=%.2f max=%.2f",
+                  name, threads, ops, ns_per_op[0], ns_per_op[rounds / 2], ns_per_op[rounds - 1]);
+  }
+
+public:
+  static const int default_warmup_rounds = 3;
+  static const int default_rounds = 10;
+
+  // Runs fun in threads threads for the warmup and measured rounds. The
+  // time per operation is the wall time of a round divided by ops, that is
+  // the time a single thread needs per operation while all threads run.
+  template<typename F>
+  static void run(const char* name, F fun, size_t ops, int threads = 1,
+                  int warmup_rounds = default_warmup_rounds,
+                  int rounds = default_rounds) {
+    assert(ops > 0 && threads > 0 && rounds > 0, "invalid benchmark parameters");
+    const int total_rounds = warmup_rounds + rounds;
+    double* ns_per_op = NEW_C_HEAP_ARRAY(double, rounds, mtTest);
+    Semaphore start(0);
+    Semaphore round_done(0);
+    Semaphore exited(0);
+
+    BenchThread<F>** t = NEW_C_HEAP_ARRAY(BenchThread<F>*, threads, mtTest);
+    for (int i = 0; i < threads; i++) {
+      t[i] = new BenchThread<F>(fun, i, ops, total_rounds, &start, &round_done, &exited);
+      t[i]->doit();
+    }
+
+    for (int r = 0; r < total_rounds; r++) {
+      Ticks begin = Ticks::now();
+      start.signal(threads);
+      for (int i = 0; i < threads; i++) {
+        round_done.wait();
+      }
+      Tickspan elapsed = Ticks::now() - begin;
+      if (r >= warmup_rounds) {
+        ns_per_op[r - warmup_rounds] = (double)elapsed.nanoseconds() / ops;
+      }
+    }
+
+    for (int i = 0; i < threads; i++) {
+      exited.wait();
+    }
+    FREE_C_HEAP_ARRAY(BenchThread<F>*, t);
+
+    report(name, threads, ops, ns_per_op, rounds);
+    FREE_C_HEAP_ARRAY(double, ns_per_op);
+  }
+};
+
+#endif // GTEST_MICROBENCHMARK_INLINE_HPP
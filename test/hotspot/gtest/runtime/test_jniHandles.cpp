@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "classfile/vmClasses.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/jniHandles.inline.hpp"
+#include "unittest.hpp"
+#include "utilities/autoRestore.hpp"
+
+static const uint cache_size = 4;
+
+TEST_VM(JNIHandles, global_handle_cache) {
+  if (CheckJNICalls) {
+    return; // The cache is not used with checked JNI.
+  }
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+
+  // The cache array is sized by the flag when it is first used, so start
+  // and end with no cache.
+  JNIHandles::release_cached_global_handles(THREAD);
+  AutoModifyRestore<uint> flag(JNIGlobalHandleCacheSize, cache_size);
+
+  Handle obj(THREAD, vmClasses::Object_klass()->java_mirror());
+
+  // A released entry is kept by the thread and handed out again.
+  jobject first = JNIHandles::make_global(obj);
+  ASSERT_NE(first, (jobject)nullptr);
+  EXPECT_TRUE(JNIHandles::resolve(first) == obj());
+  JNIHandles::destroy_global(first);
+  EXPECT_TRUE(JNIHandles::is_global_handle(first)) << "cached entry stays allocated";
+  jobject reused = JNIHandles::make_global(obj);
+  EXPECT_EQ(reused, first);
+  EXPECT_TRUE(JNIHandles::resolve(reused) == obj());
+
+  // Releasing more entries than the cache holds returns the excess to the
+  // storage.
+  jobject handles[cache_size + 1];
+  handles[0] = reused;
+  for (uint i = 1; i < cache_size + 1; i++) {
+    handles[i] = JNIHandles::make_global(obj);
+    ASSERT_NE(handles[i], (jobject)nullptr);
+  }
+  for (uint i = 0; i < cache_size + 1; i++) {
+    JNIHandles::destroy_global(handles[i]);
+  }
+  EXPECT_EQ(THREAD->cached_global_handles_count(), cache_size);
+  EXPECT_FALSE(JNIHandles::is_global_handle(handles[cache_size])) << "excess entry released";
+
+  // Releasing the cache returns all cached entries to the storage.
+  JNIHandles::release_cached_global_handles(THREAD);
+  EXPECT_EQ(THREAD->cached_global_handles_count(), 0u);
+  EXPECT_EQ(THREAD->cached_global_handles(), (oop**)nullptr);
+  for (uint i = 0; i < cache_size; i++) {
+    EXPECT_FALSE(JNIHandles::is_global_handle(handles[i])) << "cached entry released";
+  }
+}
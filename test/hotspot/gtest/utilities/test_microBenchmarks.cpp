@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "microBenchmark.inline.hpp"
+#include "unittest.hpp"
+
+// Baseline microbenchmarks for utilities, see microBenchmark.inline.hpp
+// for how to run them.
+
+static volatile uintptr_t _bench_sink = 0;
+
+struct BenchCHTConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)(value * 0x9E3779B97F4A7C15ull);
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return os::malloc(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    os::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<BenchCHTConfig, mtInternal> BenchCHT;
+
+struct BenchCHTLookup {
+  uintptr_t _val;
+  BenchCHTLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return BenchCHTConfig::get_hash(_val, nullptr);
+  }
+  bool equals(const uintptr_t* value) {
+    return _val == *value;
+  }
+  bool is_dead(const uintptr_t* value) {
+    return false;
+  }
+};
+
+static const size_t bench_cht_entries = 64 * K;
+
+static BenchCHT* bench_cht_create(Thread* thread) {
+  BenchCHT* cht = new BenchCHT(16 /* log2size */);
+  for (uintptr_t v = 1; v <= bench_cht_entries; v++) {
+    BenchCHTLookup lookup(v);
+    cht->insert(thread, lookup, v);
+  }
+  return cht;
+}
+
+static void bench_cht_get(const char* name, int threads) {
+  BenchCHT* cht = bench_cht_create(JavaThread::current());
+  auto body = [&](Thread* thread, int id, size_t ops) {
+    uintptr_t found = 0;
+    auto get = [&](uintptr_t* value) { found += *value; };
+    for (size_t i = 0; i < ops; i++) {
+      BenchCHTLookup lookup((uintptr_t)((i * 7 + id) % bench_cht_entries) + 1);
+      cht->get(thread, lookup, get);
+    }
+    Atomic::add(&_bench_sink, found);
+  };
+  MicroBenchmark::run(name, body, 1 * M, threads);
+  delete cht;
+}
+
+BENCH_VM(ConcurrentHashTable, get) {
+  bench_cht_get("ConcurrentHashTable::get", 1);
+}
+
+BENCH_VM(ConcurrentHashTable, get_mt) {
+  bench_cht_get("ConcurrentHashTable::get", MAX2(2, MIN2(8, os::processor_count())));
+}
+
+BENCH_VM(ConcurrentHashTable, insert_remove) {
+  BenchCHT* cht = bench_cht_create(JavaThread::current());
+  // Every thread inserts and removes its own values, above the prefilled ones.
+  auto body = [&](Thread* thread, int id, size_t ops) {
+    const uintptr_t base = bench_cht_entries + 1 + (uintptr_t)id * ops;
+    for (size_t i = 0; i < ops; i++) {
+      BenchCHTLookup lookup(base + i);
+      cht->insert(thread, lookup, base + i);
+    }
+    for (size_t i = 0; i < ops; i++) {
+      BenchCHTLookup lookup(base + i);
+      cht->remove(thread, lookup);
+    }
+  };
+  MicroBenchmark::run("ConcurrentHashTable::insert+remove", body, 64 * K,
+                      MAX2(1, MIN2(4, os::processor_count())));
+  delete cht;
+}
+
+BENCH_VM(BitMap, find_first_set_bit) {
+  const BitMap::idx_t size = 1 * M;
+  CHeapBitMap map(size, mtTest);
+  // Sparse bits with irregular gaps, so searches cross words.
+  for (BitMap::idx_t i = 0; i < size; i += 97 + (i % 61)) {
+    map.set_bit(i);
+  }
+  auto body = [&](Thread* thread, int id, size_t ops) {
+    BitMap::idx_t pos = 0;
+    for (size_t i = 0; i < ops; i++) {
+      pos = map.find_first_set_bit(pos + 1);
+      if (pos >= size) {
+        pos = 0;
+      }
+    }
+    Atomic::add(&_bench_sink, (uintptr_t)pos);
+  };
+  MicroBenchmark::run("BitMap::find_first_set_bit", body, 1 * M);
+}
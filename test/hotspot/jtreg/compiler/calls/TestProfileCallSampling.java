@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package compiler.calls;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+/*
+ * @test
+ * @summary Sampled call profiling in tier 3 code must not starve call sites
+ *          whose number per loop iteration shares a factor with the rate
+ * @library /test/lib /
+ *
+ * @requires vm.flagless
+ * @requires os.arch=="amd64" | os.arch=="x86_64"
+ * @requires vm.compiler1.enabled
+ *
+ * @run driver compiler.calls.TestProfileCallSampling
+ */
+public class TestProfileCallSampling {
+
+    static final int ITERATIONS = 200_000;
+    static final int SITES = 4;
+
+    static class Workload {
+        static int sum;
+
+        static void site0() { sum += 1; }
+        static void site1() { sum += 2; }
+        static void site2() { sum += 3; }
+        static void site3() { sum += 4; }
+
+        static void loop() {
+            site0();
+            site1();
+            site2();
+            site3();
+        }
+
+        public static void main(String[] args) {
+            for (int i = 0; i < ITERATIONS; i++) {
+                loop();
+            }
+            System.out.println("sum = " + sum);
+        }
+    }
+
+    static final Pattern COUNTER = Pattern.compile("CounterData\\s+count\\((\\d+)\\)");
+
+    // Extract the call counts of Workload.loop() from the -XX:+PrintMethodData output.
+    static List<Long> callCounts(String output) {
+        List<Long> counts = new ArrayList<>();
+        boolean inLoop = false;
+        for (String line : output.split("\\R")) {
+            if (line.startsWith("----")) {
+                inLoop = false;
+            } else if (line.contains("$Workload::loop()V")) {
+                inLoop = true;
+            } else if (inLoop) {
+                Matcher m = COUNTER.matcher(line);
+                if (m.find()) {
+                    counts.add(Long.parseLong(m.group(1)));
+                }
+            }
+        }
+        return counts;
+    }
+
+    static void test(int rate) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:TieredStopAtLevel=3",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:C1ProfileCallSampleRate=" + rate,
+            "-XX:InterpreterProfileSampleRate=" + rate,
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintMethodData",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=dontinline,compiler.calls.TestProfileCallSampling$Workload::site*",
+            Workload.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        List<Long> counts = callCounts(output.getStdout());
+        if (counts.size() != SITES) {
+            output.reportDiagnosticSummary();
+            throw new RuntimeException("Expected " + SITES + " call sites in loop(), found " + counts);
+        }
+        // Every site runs once per iteration. A sampling stride that aliases
+        // with the loop body leaves some sites with the few counts taken by
+        // the interpreter and credits the others with several times the
+        // real count.
+        for (int site = 0; site < SITES; site++) {
+            long count = counts.get(site);
+            if (count < ITERATIONS / 2 || count > ITERATIONS * 2L) {
+                throw new RuntimeException("Rate " + rate + ": call site " + site + " counted " + count +
+                                           " times, expected about " + ITERATIONS + ": " + counts);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (int rate : new int[] { 2, 4, 8 }) {
+            test(rate);
+        }
+    }
+}
@@ -153,6 +153,8 @@ public boolean isAvailable() {
         // Termination
         new LogMessageWithLevel("Termination \\(ms\\):", Level.DEBUG),
         new LogMessageWithLevel("Termination Attempts:", Level.DEBUG),
+        // GC Worker CPU Time
+        new LogMessageWithLevel("GC Worker CPU Time \\(ms\\):", Level.DEBUG),
         // Post Evacuate Collection Set
         // NMethod List Cleanup
         new LogMessageWithLevel("NMethod List Cleanup:", Level.DEBUG),
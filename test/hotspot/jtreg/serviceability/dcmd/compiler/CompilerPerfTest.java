@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=CITime
+ * @summary Test of diagnostic command Compiler.perf with -XX:+CITime
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+CITime CompilerPerfTest
+ */
+
+/*
+ * @test id=default
+ * @summary Test of diagnostic command Compiler.perf without -XX:+CITime
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:-CITime CompilerPerfTest
+ */
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+import java.lang.management.ManagementFactory;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import org.testng.annotations.Test;
+
+public class CompilerPerfTest {
+
+    public void run(CommandExecutor executor) {
+        boolean ciTime = Boolean.parseBoolean(ManagementFactory
+                .getPlatformMXBean(HotSpotDiagnosticMXBean.class)
+                .getVMOption("CITime").getValue());
+
+        OutputAnalyzer output = executor.execute("Compiler.perf");
+        if (ciTime) {
+            output.shouldContain("Accumulated compiler times");
+            output.shouldContain("Total compilation time");
+            output.shouldNotContain("Compilation times are not collected");
+        } else {
+            output.shouldContain("Compilation times are not collected, run with -XX:+CITime.");
+            output.shouldNotContain("Accumulated compiler times");
+        }
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+}
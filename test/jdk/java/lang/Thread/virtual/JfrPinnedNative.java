@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that the jdk.VirtualThreadPinned event names the JNI method that
+ *      pins the virtual thread
+ * @requires vm.continuations & vm.hasJFR
+ * @modules jdk.jfr jdk.management
+ * @library /test/lib
+ * @run junit/othervm/native --enable-native-access=ALL-UNNAMED JfrPinnedNative
+ */
+
+import java.io.IOException;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+import jdk.test.lib.thread.VThreadRunner;   // ensureParallelism requires jdk.management
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.BeforeAll;
+import static org.junit.jupiter.api.Assertions.*;
+
+class JfrPinnedNative {
+
+    @BeforeAll
+    static void setup() {
+        System.loadLibrary("JfrPinnedNative");
+
+        // need at least two carriers to test pinning
+        VThreadRunner.ensureParallelism(2);
+    }
+
+    /**
+     * Test that parking with a JNI upcall on the stack records the native method
+     * as the pinned reason, not the VirtualThread natives that post the event or
+     * the carrier's frames.
+     */
+    @Test
+    void testParkInUpcall() throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.VirtualThreadPinned");
+            recording.start();
+
+            var started = new AtomicBoolean();
+            var done = new AtomicBoolean();
+            var vthread = Thread.startVirtualThread(() -> {
+                runInNative(() -> {
+                    started.set(true);
+                    while (!done.get()) {
+                        LockSupport.park();
+                    }
+                });
+            });
+
+            try {
+                // wait for thread to start and park
+                while (!started.get()) {
+                    Thread.sleep(10);
+                }
+                await(vthread, Thread.State.WAITING);
+            } finally {
+                done.set(true);
+                LockSupport.unpark(vthread);
+                vthread.join();
+                recording.stop();
+            }
+
+            Path recordingFile = Path.of("recording-" + recording.getId() + "-pid"
+                    + ProcessHandle.current().pid() + ".jfr");
+            recording.dump(recordingFile);
+            List<RecordedEvent> pinnedEvents = RecordingFile.readAllEvents(recordingFile)
+                    .stream()
+                    .filter(e -> e.getEventType().getName().equals("jdk.VirtualThreadPinned"))
+                    .filter(e -> e.getThread().getJavaThreadId() == vthread.threadId())
+                    .toList();
+            System.err.println(pinnedEvents);
+            assertTrue(pinnedEvents.size() > 0, "No jdk.VirtualThreadPinned events for " + vthread);
+
+            String expected = "Native frame of void JfrPinnedNative.runInNative(java.lang.Runnable) on stack";
+            for (RecordedEvent e : pinnedEvents) {
+                assertEquals(expected, e.getString("pinnedReason"));
+            }
+        }
+    }
+
+    /**
+     * Invokes the given task's run method with this native method on the stack.
+     */
+    private static native void runInNative(Runnable task);
+
+    /**
+     * Called from the native method to run the given task.
+     */
+    private static void run(Runnable task) {
+        task.run();
+    }
+
+    /**
+     * Waits for the given thread to reach a given state.
+     */
+    private static void await(Thread thread, Thread.State expectedState) throws InterruptedException {
+        Thread.State state = thread.getState();
+        while (state != expectedState) {
+            assertTrue(state != Thread.State.TERMINATED, "Thread has terminated");
+            Thread.sleep(10);
+            state = thread.getState();
+        }
+    }
+}
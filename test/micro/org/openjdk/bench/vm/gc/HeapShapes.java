@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.lang.ref.SoftReference;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * GC pause benchmarks over synthetic live heap shapes.
+ *
+ * Each shape keeps a live object graph that stresses a different part of
+ * the collectors: marking depth, wide object arrays, humongous objects,
+ * cross-region references and soft reference processing. The "young"
+ * benchmark allocates short-lived garbage against the live shape, so its
+ * cost is dominated by young collections. The "full" benchmark measures
+ * explicit full collections of the live shape.
+ *
+ * The nested classes run the same benchmarks for each collector. Every fork
+ * writes the collector's per-phase timings (gc+phases for G1 and Parallel,
+ * gc+stats for ZGC and Shenandoah) to gc-phases-&lt;pid&gt;.log, so phase-level
+ * regressions can be compared across builds.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 3, time = 2, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+public abstract class HeapShapes {
+
+    static final String LOG = "-Xlog:gc+phases=debug,gc+stats=info:file=gc-phases-%p.log:uptime,level,tags";
+
+    @Param({"linkedList", "wideArrays", "humongous", "crossRegion", "softCache"})
+    public String shape;
+
+    private Object live;
+
+    static final class Node {
+        Node next;
+        Object ref;
+        long payload;
+    }
+
+    @Setup(Level.Trial)
+    public void setup() {
+        Random random = new Random(42);
+        switch (shape) {
+            case "linkedList": {
+                // A deep chain of 2M nodes, which marking can't parallelize well.
+                Node head = null;
+                for (int i = 0; i < 2_000_000; i++) {
+                    Node n = new Node();
+                    n.next = head;
+                    head = n;
+                }
+                live = head;
+                break;
+            }
+            case "wideArrays": {
+                // Large reference arrays that have to be split into chunks.
+                Object[][] arrays = new Object[64][];
+                for (int i = 0; i < arrays.length; i++) {
+                    arrays[i] = new Object[64 * 1024];
+                    for (int j = 0; j < arrays[i].length; j++) {
+                        arrays[i][j] = new Node();
+                    }
+                }
+                live = arrays;
+                break;
+            }
+            case "humongous": {
+                // Large primitive buffers, humongous for region based collectors.
+                byte[][] buffers = new byte[48][];
+                for (int i = 0; i < buffers.length; i++) {
+                    buffers[i] = new byte[8 * 1024 * 1024];
+                }
+                live = buffers;
+                break;
+            }
+            case "crossRegion": {
+                // Nodes referencing random other nodes, so that most references
+                // cross region boundaries.
+                Node[] nodes = new Node[2_000_000];
+                for (int i = 0; i < nodes.length; i++) {
+                    nodes[i] = new Node();
+                }
+                for (Node n : nodes) {
+                    n.next = nodes[random.nextInt(nodes.length)];
+                    n.ref = nodes[random.nextInt(nodes.length)];
+                }
+                live = nodes;
+                break;
+            }
+            case "softCache": {
+                // A cache of softly reachable values, as used by many applications.
+                Map<Integer, SoftReference<byte[]>> cache = new HashMap<>();
+                for (int i = 0; i < 200_000; i++) {
+                    cache.put(i, new SoftReference<>(new byte[256]));
+                }
+                live = cache;
+                break;
+            }
+            default:
+                throw new IllegalArgumentException("Unknown shape: " + shape);
+        }
+        System.gc();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() {
+        live = null;
+    }
+
+    @Benchmark
+    public void young(Blackhole bh) {
+        // Allocate about 64 MB of short-lived objects per operation.
+        for (int i = 0; i < 64 * 1024; i++) {
+            bh.consume(new byte[1000]);
+        }
+    }
+
+    @Benchmark
+    @BenchmarkMode(Mode.SingleShotTime)
+    @Warmup(iterations = 2)
+    @Measurement(iterations = 10)
+    public void full(Blackhole bh) {
+        System.gc();
+        bh.consume(live);
+    }
+
+    @Fork(value = 1, jvmArgs = {"-Xms4g", "-Xmx4g", "-XX:+UseG1GC", LOG})
+    public static class G1 extends HeapShapes {}
+
+    @Fork(value = 1, jvmArgs = {"-Xms4g", "-Xmx4g", "-XX:+UseParallelGC", LOG})
+    public static class Parallel extends HeapShapes {}
+
+    @Fork(value = 1, jvmArgs = {"-Xms4g", "-Xmx4g", "-XX:+UseZGC", LOG})
+    public static class Z extends HeapShapes {}
+
+    @Fork(value = 1, jvmArgs = {"-Xms4g", "-Xmx4g", "-XX:+UseShenandoahGC", LOG})
+    public static class Shenandoah extends HeapShapes {}
+}